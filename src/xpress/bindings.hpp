@@ -8,6 +8,7 @@
 #pragma once
 
 #include <type_traits>
+#include <utility>
 
 #include "utils.hpp"
 #include "dtype.hpp"
@@ -141,6 +142,27 @@ inline constexpr auto with(B&&... b) {
     return bindings{std::forward<B>(b)...};
 }
 
+#ifndef DOXYGEN
+namespace detail {
+
+    // symbol under which an instrumentation handle may be passed along with the bindings (see profiling.hpp)
+    struct instrumentation_symbol {};
+
+    // symbol under which an evaluation policy may be passed along with the bindings (see policy.hpp)
+    struct policy_symbol {};
+
+    // evaluate a composite node via the given function, instrumented if the bindings carry a handle for it
+    template<typename N, typename... V, typename F>
+    constexpr decltype(auto) instrumented_evaluation(const bindings<V...>& values, F&& evaluate) {
+        if constexpr (bindings<V...>::template has_bindings_for<instrumentation_symbol>)
+            return values[instrumentation_symbol{}].template measure<N>(std::forward<F>(evaluate));
+        else
+            return evaluate();
+    }
+
+}  // namespace detail
+#endif  // DOXYGEN
+
 //! \} group Bindings
 
 }  // namespace xp
@@ -0,0 +1,170 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Expressions
+ * \brief Generation of C++ source code from scalar expressions.
+ */
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <concepts>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "utils.hpp"
+#include "traits.hpp"
+#include "values.hpp"
+#include "expressions.hpp"
+#include "operators.hpp"
+#include "tape.hpp"
+
+
+namespace xp {
+
+//! \addtogroup Expressions
+//! \{
+
+#ifndef DOXYGEN
+namespace detail::codegen {
+
+    template<std::floating_point T>
+    constexpr std::string_view type_name() noexcept {
+        if constexpr (std::is_same_v<T, float>)
+            return "float";
+        else if constexpr (std::is_same_v<T, double>)
+            return "double";
+        else
+            return "long double";
+    }
+
+    // literal that reproduces the given value exactly when parsed as the given floating-point type
+    template<std::floating_point T, typename V>
+    std::string literal(const V& v) {
+        const std::string limits = "std::numeric_limits<" + std::string{type_name<T>()} + ">::";
+        if (std::isnan(static_cast<T>(v)))
+            return limits + "quiet_NaN()";
+        if (std::isinf(static_cast<T>(v)))
+            return static_cast<T>(v) < T{0} ? "(-" + limits + "infinity())" : limits + "infinity()";
+
+        std::array<char, 64> buffer;
+        const auto end = std::to_chars(buffer.data(), buffer.data() + buffer.size(), static_cast<T>(v)).ptr;
+        std::string result{buffer.data(), end};
+        if (result.find_first_of(".en") == std::string::npos)
+            result += ".0";
+        if constexpr (std::is_same_v<T, float>)
+            result += "f";
+        else if constexpr (std::is_same_v<T, long double>)
+            result += "L";
+        return result.starts_with('-') ? "(" + result + ")" : result;
+    }
+
+    template<std::floating_point T, typename N, typename... I, typename... C>
+    std::string name_of(const type_list<I...>& inputs, const type_list<C...>& composites) {
+        if constexpr (traits::is_constant_value_v<N>)
+            return literal<T>(traits::value_of<N>::from(bindings<>{}));
+        else if constexpr (traits::is_leaf_node_v<N>) {
+            static_assert(
+                std::disjunction_v<traits::is_equal_node<N, I>...>,
+                "All symbols in the expressions must be given as inputs of the generated function."
+            );
+            return "in[" + std::to_string(register_of<N>(inputs)) + "]";
+        } else {
+            return "t" + std::to_string(register_of<N>(composites));
+        }
+    }
+
+    template<std::floating_point T, typename op, typename A, typename B, typename... I, typename... C>
+    void write_value_of(std::ostream& out,
+                        const operation<op, A, B>&,
+                        const type_list<I...>& inputs,
+                        const type_list<C...>& composites) {
+        const std::string a = name_of<T, A>(inputs, composites);
+        const std::string b = name_of<T, B>(inputs, composites);
+        switch (traits::tape_opcode<op>::value) {
+            case bytecode::opcode::add:      out << a << " + " << b; break;
+            case bytecode::opcode::subtract: out << a << " - " << b; break;
+            case bytecode::opcode::multiply: out << a << "*" << b; break;
+            case bytecode::opcode::divide:   out << a << "/" << b; break;
+            case bytecode::opcode::pow:      out << "std::pow(" << a << ", " << b << ")"; break;
+            case bytecode::opcode::log:      break;
+        }
+    }
+
+    template<std::floating_point T, typename op, typename A, typename... I, typename... C>
+    void write_value_of(std::ostream& out,
+                        const operation<op, A>&,
+                        const type_list<I...>& inputs,
+                        const type_list<C...>& composites) {
+        static_assert(traits::tape_opcode<op>::value == bytecode::opcode::log);
+        out << "std::log(" << name_of<T, A>(inputs, composites) << ")";
+    }
+
+    template<std::floating_point T, typename N, typename... I, typename... C>
+    void write_definition_of(std::ostream& out,
+                             const type_list<N>&,
+                             const type_list<I...>& inputs,
+                             const type_list<C...>& composites) {
+        out << "    const " << type_name<T>() << " " << name_of<T, N>(inputs, composites) << " = ";
+        write_value_of<T>(out, N{}, inputs, composites);
+        out << ";\n";
+    }
+
+    template<typename R, typename... V>
+    constexpr auto derivative_expressions_of(const R&, const type_list<V...>&) noexcept {
+        return type_list<decltype(derivative_of(R{}, type_list<V>{}))...>{};
+    }
+
+}  // namespace detail::codegen
+#endif  // DOXYGEN
+
+/*!
+ * \brief Write the source code of a C++ function `void name(const T* in, T* out)` that evaluates the given
+ *        scalar expressions, where `in` holds the values of the given inputs and `out` receives the values
+ *        of the outputs in the given order.
+ * \details Each unique subexpression (across all outputs) is computed once and stored in a temporary, such that
+ *          common subexpressions are not recomputed. The generated code only depends on `std::pow` and `std::log`,
+ *          so `<cmath>` has to be included in the translation unit it is compiled in. Non-finite constants are
+ *          written via `std::numeric_limits`, which then additionally requires `<limits>`.
+ */
+template<std::floating_point T = double, typename... I, expression... O>
+void generate_function(std::ostream& out, std::string_view name, const type_list<I...>& inputs, const O&...) {
+    using nodes = typename traits::detail::unique_nodes_of<traits::merged_nodes_of_t<O...>>::type;
+    using composites = typename detail::reversed<filtered_t<traits::is_composite_node, nodes>>::type;
+    constexpr auto type = detail::codegen::type_name<T>();
+
+    out << "void " << name << "(const " << type << "* in, " << type << "* out) {\n";
+    [&] <typename... C> (const type_list<C...>&) {
+        (..., detail::codegen::write_definition_of<T>(out, type_list<C>{}, inputs, composites{}));
+    } (composites{});
+
+    std::size_t i = 0;
+    (..., (out << "    out[" << i++ << "] = " << detail::codegen::name_of<T, O>(inputs, composites{}) << ";\n"));
+    out << "}\n";
+}
+
+/*!
+ * \brief Write the source code of a C++ function `void name(const T* in, T* out)` that evaluates the given
+ *        residual expressions and their derivatives w.r.t. the given variables.
+ * \details For `n` residuals and `m` variables, `in` holds the `m` values of the variables and the first `n`
+ *          entries of `out` receive the residuals, followed by the `n x m` entries of the Jacobian in row-major
+ *          order. See \ref generate_function.
+ */
+template<std::floating_point T = double, typename... V, expression... R>
+void generate_residual_and_jacobian(std::ostream& out,
+                                    std::string_view name,
+                                    const type_list<V...>& variables,
+                                    const R&... residuals) {
+    [&] <typename... D> (const type_list<D...>&) {
+        generate_function<T>(out, name, variables, residuals..., D{}...);
+    } (typename detail::concatenated<decltype(detail::codegen::derivative_expressions_of(residuals, variables))...>::type{});
+}
+
+//! \} group Expressions
+
+}  // namespace xp
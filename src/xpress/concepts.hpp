@@ -48,6 +48,10 @@ concept variable = traits::is_variable_v<T>;
 template<typename T>
 concept expression = traits::is_expression_v<T>;
 
+//! Expressions that evaluate to a tensor of known shape, but whose entries may not be accessible as expressions
+template<typename T>
+concept tensor_valued_expression = expression<T> and is_complete_v<shape_of<T>>;
+
 template<typename T>
 concept tensorial_expression = expression<T> and is_complete_v<shape_of<T>> and requires(const T& t) {
     { t[ *(md_index_iterator{shape_of_t<T>{}}) ] } -> expression;
@@ -0,0 +1,176 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Expressions
+ * \brief Compile-time estimates of the cost of evaluating and differentiating expressions.
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+#include "utils.hpp"
+#include "traits.hpp"
+#include "expressions.hpp"
+#include "operators.hpp"
+#include "tensor.hpp"
+
+
+namespace xp {
+
+//! \addtogroup Expressions
+//! \{
+
+//! Summary of the cost of evaluating and differentiating an expression
+struct expression_cost {
+    std::size_t nodes = 0;             //!< number of nodes in the expression tree
+    std::size_t unique_nodes = 0;      //!< number of unique nodes, i.e. those evaluated when sharing subexpressions
+    std::size_t depth = 0;             //!< length of the longest path from the root to a leaf
+    std::size_t additions = 0;         //!< number of additions in the expression tree
+    std::size_t subtractions = 0;      //!< number of subtractions in the expression tree
+    std::size_t multiplications = 0;   //!< number of multiplications in the expression tree
+    std::size_t divisions = 0;         //!< number of divisions in the expression tree
+    std::size_t powers = 0;            //!< number of powers in the expression tree
+    std::size_t logarithms = 0;        //!< number of logarithms in the expression tree
+    std::size_t other_operations = 0;  //!< number of other operations in the expression tree
+    std::size_t weight = 0;            //!< sum of the operator costs over the expression tree
+    std::size_t unique_weight = 0;     //!< sum of the operator costs over all unique nodes
+    std::size_t derivative_nodes = 0;  //!< estimated number of nodes in the tree of a first derivative
+
+    //! Return the total number of operations in the expression tree
+    constexpr std::size_t operations() const noexcept {
+        return additions + subtractions + multiplications + divisions + powers + logarithms + other_operations;
+    }
+
+    //! Return the estimated ratio between the sizes of the derivative and expression trees
+    constexpr double derivative_growth() const noexcept {
+        return static_cast<double>(derivative_nodes)/static_cast<double>(nodes);
+    }
+};
+
+
+#ifndef DOXYGEN
+namespace detail::cost {
+
+    template<typename T>
+    struct tree_cost {
+        static constexpr expression_cost value{.nodes = 1, .depth = 1, .derivative_nodes = 1};
+    };
+
+    template<typename... C>
+    constexpr expression_cost sum_of(const C&... children) noexcept {
+        expression_cost result{};
+        (..., (
+            result.nodes += children.nodes,
+            result.depth = std::max(result.depth, children.depth),
+            result.additions += children.additions,
+            result.subtractions += children.subtractions,
+            result.multiplications += children.multiplications,
+            result.divisions += children.divisions,
+            result.powers += children.powers,
+            result.logarithms += children.logarithms,
+            result.other_operations += children.other_operations,
+            result.weight += children.weight,
+            result.derivative_nodes += children.derivative_nodes
+        ));
+        result.nodes += 1;
+        result.depth += 1;
+        return result;
+    }
+
+    // number of nodes added by the chain rule on top of the derivatives of the operands,
+    // following the symbolic derivative rules of the operators
+    template<typename op, typename... Ts>
+    constexpr std::size_t chain_rule_nodes(std::size_t nodes) noexcept {
+        constexpr std::array<std::size_t, sizeof...(Ts)> n{tree_cost<Ts>::value.nodes...};
+        if constexpr (is_any_of_v<op, operators::add, operators::subtract>)
+            return 1;
+        else if constexpr (std::is_same_v<op, operators::multiply>)
+            return n[0] + n[1] + 3;
+        else if constexpr (std::is_same_v<op, operators::divide>)
+            return n[0] + 3*n[1] + 5;
+        else if constexpr (std::is_same_v<op, operators::pow>)
+            return 3*n[0] + 3*n[1] + 8;
+        else if constexpr (std::is_same_v<op, operators::log>)
+            return n[0] + 1;
+        else
+            return sizeof...(Ts)*(nodes + 1);
+    }
+
+    template<typename op, typename... Ts>
+    struct tree_cost<operation<op, Ts...>> {
+     private:
+        static constexpr expression_cost make() noexcept {
+            expression_cost result = sum_of(tree_cost<Ts>::value...);
+            if constexpr (std::is_same_v<op, operators::add>) result.additions++;
+            else if constexpr (std::is_same_v<op, operators::subtract>) result.subtractions++;
+            else if constexpr (std::is_same_v<op, operators::multiply>) result.multiplications++;
+            else if constexpr (std::is_same_v<op, operators::divide>) result.divisions++;
+            else if constexpr (std::is_same_v<op, operators::pow>) result.powers++;
+            else if constexpr (std::is_same_v<op, operators::log>) result.logarithms++;
+            else result.other_operations++;
+            result.weight += operators::traits::cost<op>::value;
+            result.derivative_nodes += chain_rule_nodes<op, Ts...>(result.nodes);
+            return result;
+        }
+
+     public:
+        static constexpr expression_cost value = make();
+    };
+
+    template<typename shape, typename... E>
+    struct tree_cost<tensor_expression<shape, E...>> {
+        static constexpr expression_cost value = sum_of(tree_cost<E>::value...);
+    };
+
+    template<typename T>
+    struct node_weight : std::integral_constant<std::size_t, 0> {};
+    template<typename op, typename... Ts>
+    struct node_weight<operation<op, Ts...>> : operators::traits::cost<op> {};
+
+    template<typename T>
+    struct unique_weight;
+    template<typename... N>
+    struct unique_weight<type_list<N...>> : std::integral_constant<std::size_t, (0 + ... + node_weight<N>::value)> {};
+
+}  // namespace detail::cost
+#endif  // DOXYGEN
+
+
+namespace traits {
+
+/*!
+ * \brief Trait to estimate the cost of evaluating and differentiating an expression at compile time.
+ * \details The weights of the operators can be customized by specializing `operators::traits::cost`.
+ *          Counts on the expression tree reflect the work done by `value_of`, while the counts on unique
+ *          nodes reflect the work done when evaluating with shared subexpressions (e.g. on a tape).
+ *          The size of the derivative is estimated from the derivative rules without instantiating the
+ *          derivative, and it assumes that all leaf nodes depend on the variable.
+ */
+template<typename E>
+struct cost_of {
+    static constexpr expression_cost value = [] () {
+        expression_cost result = xp::detail::cost::tree_cost<E>::value;
+        result.unique_nodes = unique_nodes_of_t<E>::size;
+        result.unique_weight = xp::detail::cost::unique_weight<unique_nodes_of_t<E>>::value;
+        return result;
+    } ();
+};
+
+template<typename E>
+inline constexpr expression_cost cost_of_v = cost_of<std::remove_cvref_t<E>>::value;
+
+}  // namespace traits
+
+//! Return the estimated cost of evaluating and differentiating the given expression
+template<expression E>
+inline constexpr expression_cost cost_of(const E&) noexcept {
+    return traits::cost_of_v<E>;
+}
+
+//! \} group Expressions
+
+}  // namespace xp
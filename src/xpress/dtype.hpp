@@ -23,6 +23,8 @@ namespace dtype {
 struct any {};
 struct real {};
 struct integral {};
+struct float32 {};  //!< single-precision floating-point values, i.e. `float`
+struct float64 {};  //!< double-precision floating-point values, i.e. `double`
 
 }  // namespace dtype
 
@@ -42,6 +44,14 @@ template<tensorial Arg>
 struct is_bindable<dtype::real, Arg> : is_bindable<dtype::real, scalar_type_t<Arg>> {};
 template<tensorial Arg>
 struct is_bindable<dtype::integral, Arg> : is_bindable<dtype::integral, scalar_type_t<Arg>> {};
+template<typename Arg>
+struct is_bindable<dtype::float32, Arg> : std::is_same<std::remove_cvref_t<Arg>, float> {};
+template<tensorial Arg>
+struct is_bindable<dtype::float32, Arg> : is_bindable<dtype::float32, scalar_type_t<Arg>> {};
+template<typename Arg>
+struct is_bindable<dtype::float64, Arg> : std::is_same<std::remove_cvref_t<Arg>, double> {};
+template<tensorial Arg>
+struct is_bindable<dtype::float64, Arg> : is_bindable<dtype::float64, scalar_type_t<Arg>> {};
 
 #ifndef DOXYGEN
 namespace detail {
@@ -49,6 +59,9 @@ namespace detail {
     template<typename T> requires(is_value_v<T>)
     using dtype_for = std::conditional_t<std::floating_point<scalar_type_t<T>>, dtype::real, dtype::integral>;
 
+    template<typename T>
+    inline constexpr bool is_sized_float = is_any_of_v<T, dtype::float32, dtype::float64>;
+
 }  // namespace detail
 #endif  // DOXYGEN
 
@@ -61,6 +74,20 @@ template<typename T> requires(is_value_v<T>) struct common_dtype<T, dtype::integ
 template<typename T> requires(is_value_v<T>) struct common_dtype<dtype::real, T> : std::type_identity<dtype::real> {};
 template<typename T> requires(is_value_v<T>) struct common_dtype<T, dtype::real> : std::type_identity<dtype::real> {};
 
+template<> struct common_dtype<dtype::float32, dtype::float64> : std::type_identity<dtype::float64> {};
+template<> struct common_dtype<dtype::float64, dtype::float32> : std::type_identity<dtype::float64> {};
+
+template<typename T> requires(detail::is_sized_float<T>) struct common_dtype<T, dtype::integral> : std::type_identity<T> {};
+template<typename T> requires(detail::is_sized_float<T>) struct common_dtype<dtype::integral, T> : std::type_identity<T> {};
+
+template<typename T> requires(detail::is_sized_float<T>) struct common_dtype<T, dtype::real> : std::type_identity<dtype::real> {};
+template<typename T> requires(detail::is_sized_float<T>) struct common_dtype<dtype::real, T> : std::type_identity<dtype::real> {};
+
+template<typename F, typename T> requires(detail::is_sized_float<F> and is_value_v<T>)
+struct common_dtype<F, T> : common_dtype<F, detail::dtype_for<T>> {};
+template<typename F, typename T> requires(detail::is_sized_float<F> and is_value_v<T>)
+struct common_dtype<T, F> : common_dtype<F, detail::dtype_for<T>> {};
+
 template<typename T> requires(not std::is_same_v<T, dtype::any>) struct common_dtype<T, dtype::any> : std::type_identity<dtype::any> {};
 template<typename T> requires(not std::is_same_v<T, dtype::any>) struct common_dtype<dtype::any, T> : std::type_identity<dtype::any> {};
 
@@ -7,6 +7,7 @@
  */
 #pragma once
 
+#include <tuple>
 #include <utility>
 #include <ostream>
 #include <concepts>
@@ -17,6 +18,7 @@
 #include "bindings.hpp"
 #include "values.hpp"
 #include "traits.hpp"
+#include "policy.hpp"
 #include "concepts.hpp"
 #include "derivatives.hpp"
 
@@ -89,9 +91,13 @@ namespace detail {
 }  // namespace detail
 #endif  // DOXYGEN
 
+//! Exposes an interface for the evaluation of one or more expressions
+template<expression... E>
+struct evaluator;
+
 //! Exposes an interface for the evaluation of an expression
 template<expression E>
-struct evaluator {
+struct evaluator<E> {
     constexpr evaluator(const E&) noexcept {}
 
     //! Evaluate the expression at the given (bound) values
@@ -121,6 +127,9 @@ struct evaluator {
     }
 };
 
+template<expression... E>
+evaluator(const E&...) -> evaluator<E...>;
+
 //! Exposes an interface for the differentiation of an expression
 template<expression E>
 struct differentiator {
@@ -146,6 +155,37 @@ inline constexpr decltype(auto) value_of(const E& expr, const bindings<V...>& va
     return evaluator{expr}.at(values);
 }
 
+#ifndef DOXYGEN
+namespace detail {
+
+    // tuple of binders referencing the values of the given bindings, except for the value bound to the symbol S
+    template<typename S, typename... V>
+    constexpr auto binders_without(const bindings<V...>& values) noexcept {
+        return std::tuple_cat([&] () {
+            if constexpr (std::is_same_v<typename V::symbol_type, S>)
+                return std::tuple<>{};
+            else
+                return std::tuple{value_binder{typename V::symbol_type{}, values[typename V::symbol_type{}]}};
+        } ()...);
+    }
+
+}  // namespace detail
+#endif  // DOXYGEN
+
+/*!
+ * \brief Evaluate the given expression from the given value bindings with the given policy (see policy.hpp).
+ * \details For instance, `value_of<policy::fast>(expr, values)` evaluates all operators that support it with fast
+ *          approximations, while the default `value_of(expr, values)` evaluates them precisely. A policy that is
+ *          already carried by the bindings is replaced.
+ */
+template<typename P, expression E, typename... V>
+    requires(traits::is_policy_v<P> and evaluatable_with<E, V...>)
+inline constexpr auto value_of(const E& expr, const bindings<V...>& values) noexcept {
+    return std::apply([&] <typename... B> (B&&... binders) {
+        return value_of(expr, bindings{std::forward<B>(binders)..., value_binder{detail::policy_symbol{}, P{}}});
+    }, detail::binders_without<detail::policy_symbol>(values));
+}
+
 //! Return the expression of the derivative of the given expression w.r.t the given variable
 template<expression E, typename V>
 inline constexpr auto derivative_of(const E& expr, const type_list<V>&) noexcept {
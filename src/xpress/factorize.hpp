@@ -0,0 +1,238 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Expressions
+ * \brief Transformation that factors common multiplicands out of sums.
+ */
+#pragma once
+
+#include <array>
+#include <tuple>
+#include <type_traits>
+
+#include "utils.hpp"
+#include "traits.hpp"
+#include "values.hpp"
+#include "expressions.hpp"
+#include "operators.hpp"
+#include "tensor.hpp"
+
+
+namespace xp {
+
+//! \addtogroup Expressions
+//! \{
+
+#ifndef DOXYGEN
+namespace detail::factorization {
+
+    // a term of a sum, i.e. a (possibly negated) product of factors
+    template<bool negative, typename... F>
+    struct product_term {};
+
+    template<typename T>
+    inline constexpr bool is_scalar_chain = !has_tensorial_node<traits::nodes_of_t<T>>::value;
+
+    template<typename op, typename... Ts>
+    constexpr auto factorized(const operation<op, Ts...>&) noexcept;
+    template<typename shape, typename... E>
+    constexpr auto factorized(const tensor_expression<shape, E...>&) noexcept;
+    template<typename E>
+    constexpr auto factorized(const E&) noexcept;
+
+    template<typename A, typename B> requires(is_scalar_chain<operation<operators::multiply, A, B>>)
+    constexpr auto factors_of(const operation<operators::multiply, A, B>&) noexcept;
+    template<typename E>
+    constexpr auto factors_of(const E&) noexcept;
+
+    template<bool negative, typename A, typename B> requires(is_scalar_chain<operation<operators::add, A, B>>)
+    constexpr auto terms_of(const operation<operators::add, A, B>&) noexcept;
+    template<bool negative, typename A, typename B> requires(is_scalar_chain<operation<operators::subtract, A, B>>)
+    constexpr auto terms_of(const operation<operators::subtract, A, B>&) noexcept;
+    template<bool negative, typename E>
+    constexpr auto terms_of(const E&) noexcept;
+
+    template<typename A, typename B> requires(is_scalar_chain<operation<operators::multiply, A, B>>)
+    constexpr auto factors_of(const operation<operators::multiply, A, B>&) noexcept {
+        return merged_t<decltype(factors_of(A{})), decltype(factors_of(B{}))>{};
+    }
+
+    template<typename E>
+    constexpr auto factors_of(const E& e) noexcept {
+        return type_list<decltype(factorized(e))>{};
+    }
+
+    template<bool negative, typename A, typename B> requires(is_scalar_chain<operation<operators::add, A, B>>)
+    constexpr auto terms_of(const operation<operators::add, A, B>&) noexcept {
+        return merged_t<decltype(terms_of<negative>(A{})), decltype(terms_of<negative>(B{}))>{};
+    }
+
+    template<bool negative, typename A, typename B> requires(is_scalar_chain<operation<operators::subtract, A, B>>)
+    constexpr auto terms_of(const operation<operators::subtract, A, B>&) noexcept {
+        return merged_t<decltype(terms_of<negative>(A{})), decltype(terms_of<!negative>(B{}))>{};
+    }
+
+    template<bool negative, typename E>
+    constexpr auto terms_of(const E& e) noexcept {
+        return [] <typename... F> (const type_list<F...>&) {
+            return type_list<product_term<negative, F...>>{};
+        } (factors_of(e));
+    }
+
+    template<bool negative, typename... F>
+    constexpr auto product_of(const product_term<negative, F...>&) noexcept {
+        return (val<1>* ... *F{});
+    }
+
+    template<bool negative, typename... F>
+    constexpr auto signed_product_of(const product_term<negative, F...>& term) noexcept {
+        if constexpr (negative)
+            return -product_of(term);
+        else
+            return product_of(term);
+    }
+
+    template<typename S, bool negative, typename... F>
+    constexpr auto add_to(const S& sum, const product_term<negative, F...>& term) noexcept {
+        if constexpr (negative)
+            return sum - product_of(term);
+        else
+            return sum + product_of(term);
+    }
+
+    template<typename S>
+    constexpr auto sum_of(const S& sum, const type_list<>&) noexcept {
+        return sum;
+    }
+
+    template<typename S, typename T0, typename... T>
+    constexpr auto sum_of(const S& sum, const type_list<T0, T...>&) noexcept {
+        return sum_of(add_to(sum, T0{}), type_list<T...>{});
+    }
+
+    template<typename T0, typename... T>
+    constexpr auto sum_of(const type_list<T0, T...>&) noexcept {
+        return sum_of(signed_product_of(T0{}), type_list<T...>{});
+    }
+
+    template<typename C, bool negative, typename... F>
+    constexpr bool contains_factor(const product_term<negative, F...>&) noexcept {
+        return std::disjunction_v<traits::is_equal_node<C, F>...>;
+    }
+
+    template<typename C, bool negative, typename... F>
+    constexpr auto without_factor(const product_term<negative, F...>&) noexcept {
+        return [] <typename... R> (const type_list<R...>&) {
+            return product_term<negative, R...>{};
+        } (typename without_first_equal_node<C, type_list<>, type_list<F...>>::type{});
+    }
+
+    template<typename C, typename... T>
+    constexpr auto terms_with_factor(const type_list<T...>&) noexcept {
+        return typename concatenated<std::conditional_t<
+            contains_factor<C>(T{}),
+            type_list<decltype(without_factor<C>(T{}))>,
+            type_list<>
+        >...>::type{};
+    }
+
+    template<typename C, typename... T>
+    constexpr auto terms_without_factor(const type_list<T...>&) noexcept {
+        return typename concatenated<std::conditional_t<
+            contains_factor<C>(T{}),
+            type_list<>,
+            type_list<T>
+        >...>::type{};
+    }
+
+    template<typename C, typename... T>
+    constexpr std::size_t occurrences_of(const type_list<T...>&) noexcept {
+        return (std::size_t{0} + ... + (contains_factor<C>(T{}) ? 1 : 0));
+    }
+
+    template<bool negative, typename... F>
+    constexpr auto candidate_factors_of(const product_term<negative, F...>&) noexcept {
+        return typename concatenated<std::conditional_t<
+            traits::is_constant_value_v<F>,
+            type_list<>,
+            type_list<F>
+        >...>::type{};
+    }
+
+    // returns the (non-constant) factor shared by most terms, or `none` if no factor occurs in more than one term
+    template<typename... T>
+    constexpr auto most_common_factor_in(const type_list<T...>&) noexcept {
+        using candidates = typename concatenated<decltype(candidate_factors_of(T{}))...>::type;
+        return [] <typename... C> (const type_list<C...>&) {
+            if constexpr (sizeof...(C) == 0)
+                return none{};
+            else {
+                constexpr std::array<std::size_t, sizeof...(C)> occurrences{occurrences_of<C>(type_list<T...>{})...};
+                constexpr std::size_t best = [&] () {
+                    std::size_t result = 0;
+                    for (std::size_t i = 1; i < occurrences.size(); ++i)
+                        if (occurrences[i] > occurrences[result])
+                            result = i;
+                    return result;
+                } ();
+                if constexpr (occurrences[best] < 2)
+                    return none{};
+                else
+                    return std::tuple_element_t<best, std::tuple<C...>>{};
+            }
+        } (candidates{});
+    }
+
+    template<typename... T>
+    constexpr auto factorized_sum(const type_list<T...>& terms) noexcept {
+        using factor = decltype(most_common_factor_in(terms));
+        if constexpr (std::is_same_v<factor, none>)
+            return sum_of(terms);
+        else {
+            using with_factor = decltype(terms_with_factor<factor>(terms));
+            using without_factor = decltype(terms_without_factor<factor>(terms));
+            if constexpr (without_factor::size == 0)
+                return factor{}*factorized_sum(with_factor{});
+            else
+                return factorized_sum(without_factor{}) + factor{}*factorized_sum(with_factor{});
+        }
+    }
+
+    template<typename op, typename... Ts>
+    constexpr auto factorized(const operation<op, Ts...>& e) noexcept {
+        if constexpr (is_any_of_v<op, operators::add, operators::subtract> and is_scalar_chain<operation<op, Ts...>>)
+            return factorized_sum(terms_of<false>(e));
+        else
+            return operation<op, decltype(factorized(Ts{}))...>{};
+    }
+
+    template<typename shape, typename... E>
+    constexpr auto factorized(const tensor_expression<shape, E...>&) noexcept {
+        return tensor_expression{shape{}, factorized(E{})...};
+    }
+
+    template<typename E>
+    constexpr auto factorized(const E& e) noexcept {
+        return e;
+    }
+
+}  // namespace detail::factorization
+#endif  // DOXYGEN
+
+/*!
+ * \brief Return an expression in which common multiplicands are factored out of sums.
+ * \details Sums of products are rewritten recursively by factoring out the multiplicand shared by most terms,
+ *          e.g. `a*b + a*c` becomes `a*(b + c)`. For polynomials in a single variable written term by term, e.g.
+ *          `c0 + c1*x + c2*x*x`, this yields the Horner form `c0 + x*(c1 + c2*x)`. Constant values are not factored
+ *          out, and powers written via `pow` are treated as opaque multiplicands. Sums and products involving
+ *          tensorial expressions are left as they are.
+ */
+template<expression E>
+inline constexpr auto factorize(const E& expression) noexcept {
+    return detail::factorization::factorized(expression);
+}
+
+//! \} group Expressions
+
+}  // namespace xp
@@ -0,0 +1,342 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Utilities
+ * \brief Fast approximations of elementary functions.
+ * \details The approximations use range reduction followed by polynomial evaluation, without branches or table
+ *          lookups, such that loops over them can be vectorized by the compiler. The maximum errors given in
+ *          the documentation of the functions were measured on dense samplings of the stated domains, relative
+ *          to the corresponding libm functions. Outside of the stated domains, the results are unspecified.
+ */
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <concepts>
+#include <type_traits>
+#include <utility>
+
+
+namespace xp::fast_math {
+
+//! \addtogroup Utilities
+//! \{
+
+#ifndef DOXYGEN
+namespace detail {
+
+    template<std::floating_point T>
+    struct constants;
+
+    template<>
+    struct constants<double> {
+        using bits = std::uint64_t;
+        static constexpr bits sign_mask = bits{1} << 63;
+        static constexpr int mantissa_digits = 52;
+        static constexpr int exponent_bias = 1023;
+        static constexpr double max_exp_argument = 710.0;     // e^x overflows for larger arguments
+        static constexpr double min_exp_argument = -746.0;    // e^x underflows to zero for smaller arguments
+        static constexpr double min_expm1_argument = -40.0;   // e^x - 1 rounds to -1 for smaller arguments
+        static constexpr double rounding_shift = 6755399441055744.0;  // 1.5*2^52
+        static constexpr double ln2_hi = 6.93147180369123816490e-01;
+        static constexpr double ln2_lo = 1.90821492927058770002e-10;
+        static constexpr double pi_2_hi = 1.57079632673412561417e+00;
+        static constexpr double pi_2_mid = 6.07710050630396597660e-11;
+        static constexpr double pi_2_lo = 2.02226624879595063154e-21;
+        static constexpr std::size_t exp_degree = 13;
+        static constexpr std::size_t sin_degree = 17;
+        static constexpr std::size_t cos_degree = 18;
+        static constexpr std::size_t log_degree = 10;
+    };
+
+    template<>
+    struct constants<float> {
+        using bits = std::uint32_t;
+        static constexpr bits sign_mask = bits{1} << 31;
+        static constexpr int mantissa_digits = 23;
+        static constexpr int exponent_bias = 127;
+        static constexpr float max_exp_argument = 89.0f;
+        static constexpr float min_exp_argument = -104.0f;
+        static constexpr float min_expm1_argument = -20.0f;
+        static constexpr float rounding_shift = 12582912.0f;  // 1.5*2^23
+        static constexpr float ln2_hi = 0.693115234375f;
+        static constexpr float ln2_lo = 3.194618329871446e-05f;
+        static constexpr float pi_2_hi = 1.5703125f;
+        static constexpr float pi_2_mid = 4.839897155761719e-04f;
+        static constexpr float pi_2_lo = -1.6292068494294654e-07f;
+        static constexpr std::size_t exp_degree = 7;
+        static constexpr std::size_t sin_degree = 9;
+        static constexpr std::size_t cos_degree = 10;
+        static constexpr std::size_t log_degree = 4;
+    };
+
+    // Taylor coefficients 1/k! for k = 0, 1, ...
+    inline constexpr auto inverse_factorials = [] () {
+        std::array<double, 20> result{};
+        double factorial = 1.0;
+        for (std::size_t k = 0; k < result.size(); ++k) {
+            factorial *= k > 0 ? static_cast<double>(k) : 1.0;
+            result[k] = 1.0/factorial;
+        }
+        return result;
+    } ();
+
+    // coefficients 1/(2k + 1) for k = 0, 1, ... of the series of atanh(x)/x in x^2
+    inline constexpr auto inverse_odd_numbers = [] () {
+        std::array<double, 20> result{};
+        for (std::size_t k = 0; k < result.size(); ++k)
+            result[k] = 1.0/static_cast<double>(2*k + 1);
+        return result;
+    } ();
+
+    // evaluate sum_j c_(first + j*step) x^j for first + j*step <= last with Horner's scheme (unrolled at compile time)
+    template<const auto& c, std::size_t first, std::size_t last, std::size_t step, std::floating_point T>
+    constexpr T series(T x) noexcept {
+        return [&] <std::size_t... j> (std::index_sequence<j...>) {
+            T result = static_cast<T>(c[last]);
+            (..., (result = result*x + static_cast<T>(c[last - (j + 1)*step])));
+            return result;
+        } (std::make_index_sequence<(last - first)/step>{});
+    }
+
+    // round to the nearest integer (for |x| < 2^(mantissa_digits - 1)) in a branch-free way
+    template<std::floating_point T>
+    constexpr T rounded(T x) noexcept {
+        return (x + constants<T>::rounding_shift) - constants<T>::rounding_shift;
+    }
+
+    // Conditionals on floating-point comparisons are not turned into vector blends by some compilers (e.g. GCC
+    // without -fno-trapping-math), so the helpers below select values via operations on the bit patterns.
+
+    template<std::floating_point T>
+    constexpr auto sign_bits_of(T x) noexcept {
+        return std::bit_cast<typename constants<T>::bits>(x) & constants<T>::sign_mask;
+    }
+
+    // x with its sign flipped where the given sign bits are set
+    template<std::floating_point T>
+    constexpr T sign_flipped(T x, typename constants<T>::bits sign) noexcept {
+        return std::bit_cast<T>(std::bit_cast<typename constants<T>::bits>(x) ^ sign);
+    }
+
+    template<std::floating_point T>
+    constexpr T magnitude_of(T x) noexcept {
+        return sign_flipped(x, sign_bits_of(x));
+    }
+
+    // x clamped to [-lower, upper] for non-negative bounds
+    template<std::floating_point T>
+    constexpr T clamped(T x, T lower, T upper) noexcept {
+        using bits = typename constants<T>::bits;
+        const bits sign = sign_bits_of(x);
+        const bits limit = sign ? std::bit_cast<bits>(lower) : std::bit_cast<bits>(upper);
+        const bits magnitude = std::bit_cast<bits>(x) & ~constants<T>::sign_mask;
+        return std::bit_cast<T>((magnitude > limit ? limit : magnitude) | sign);
+    }
+
+    // bit pattern whose lowest bits hold the given integral value in two's complement, obtained
+    // without a floating-point to integer conversion (which lacks vector instructions on many targets)
+    template<std::floating_point T>
+    constexpr auto integer_bits(T k) noexcept {
+        return std::bit_cast<typename constants<T>::bits>(k + constants<T>::rounding_shift);
+    }
+
+    // 2^k for integral k within the range of normal numbers
+    template<std::floating_point T>
+    constexpr T exp2i(T k) noexcept {
+        using c = constants<T>;
+        using bits = typename c::bits;
+        return std::bit_cast<T>(static_cast<bits>((integer_bits(k) + c::exponent_bias) << c::mantissa_digits));
+    }
+
+    // x*2^k for integral k within twice the range of normal numbers, computed with two normal factors such that the
+    // result over- or underflows (gradually) like the exact one
+    template<std::floating_point T>
+    constexpr T scaled(T x, T k) noexcept {
+        const T k_half = rounded(k*T{0.5});
+        return exp2i(k_half)*(exp2i(k - k_half)*x);
+    }
+
+    // e^r - 1 for |r| <= ln(2)/2
+    template<std::floating_point T>
+    constexpr T expm1_reduced(T r) noexcept {
+        return r*series<inverse_factorials, 1, constants<T>::exp_degree, 1>(r);
+    }
+
+    // e^x = 2^k*e^r with x = k*ln(2) + r, |r| <= ln(2)/2, where k and r are written into the given arguments
+    template<std::floating_point T>
+    constexpr void reduce_exp_argument(T x, T& k, T& r) noexcept {
+        constexpr T log2e = static_cast<T>(1.4426950408889634);
+        using c = constants<T>;
+        k = rounded(x*log2e);
+        r = (x - k*c::ln2_hi) - k*c::ln2_lo;
+    }
+
+    // sin(x) = +/- sin(r) or +/- cos(r) with x = k*pi/2 + r, |r| <= pi/4, where k and r are written into the
+    // given arguments
+    template<std::floating_point T>
+    constexpr void reduce_trigonometric_argument(T x, T& k, T& r) noexcept {
+        constexpr T two_over_pi = static_cast<T>(0.63661977236758134308);
+        using c = constants<T>;
+        k = rounded(x*two_over_pi);
+        r = ((x - k*c::pi_2_hi) - k*c::pi_2_mid) - k*c::pi_2_lo;
+    }
+
+    template<std::floating_point T>
+    constexpr T sin_reduced(T r) noexcept {
+        return r*series<inverse_factorials, 1, constants<T>::sin_degree, 2>(-r*r);
+    }
+
+    template<std::floating_point T>
+    constexpr T cos_reduced(T r) noexcept {
+        return series<inverse_factorials, 0, constants<T>::cos_degree, 2>(-r*r);
+    }
+
+    // select +/- sin(r) or +/- cos(r) depending on the quadrant k (shifted by the given number of quadrants)
+    template<std::floating_point T>
+    constexpr T quadrant_value(T k, T sin_r, T cos_r, unsigned shift) noexcept {
+        using c = constants<T>;
+        using bits = typename c::bits;
+        const bits quadrant = integer_bits(k) + shift;
+        const bits cos_mask = bits{0} - (quadrant & 1);
+        const bits value = (std::bit_cast<bits>(cos_r) & cos_mask) | (std::bit_cast<bits>(sin_r) & ~cos_mask);
+        return sign_flipped(std::bit_cast<T>(value), static_cast<bits>((quadrant & 2) << (8*sizeof(bits) - 2)));
+    }
+
+    // log(x) = e*ln(2) + log(m) with x = 2^e*m and sqrt(1/2) <= m < sqrt(2), for positive normal x
+    template<std::floating_point T>
+    constexpr T log_of_positive(T x) noexcept {
+        using c = constants<T>;
+        using bits = typename c::bits;
+        constexpr T sqrt_2 = static_cast<T>(1.41421356237309504880);
+        constexpr bits bias = static_cast<bits>(c::exponent_bias);
+        const bits biased_exponent = std::bit_cast<bits>(x*sqrt_2) >> c::mantissa_digits;
+        const T m = std::bit_cast<T>(static_cast<bits>(
+            std::bit_cast<bits>(x) + (bias << c::mantissa_digits) - (biased_exponent << c::mantissa_digits)
+        ));
+        const T e = std::bit_cast<T>(static_cast<bits>(std::bit_cast<bits>(c::rounding_shift) + biased_exponent))
+            - c::rounding_shift - static_cast<T>(c::exponent_bias);
+
+        // log(1 + f) = 2*atanh(s) = 2s + 2s^3/3 + ... with s = f/(2 + f), written as f - s*(f - R(s)),
+        // such that the error of the correction term is small compared to the exactly computed f = m - 1
+        const T f = m - T{1};
+        const T s = f/(T{2} + f);
+        const T z = s*s;
+        const T log_m = f - s*(f - T{2}*z*series<inverse_odd_numbers, 1, c::log_degree, 1>(z));
+        return e*c::ln2_hi + (e*c::ln2_lo + log_m);
+    }
+
+    template<typename T>
+    using floating_point_for = std::conditional_t<std::is_floating_point_v<T>, T, double>;
+
+}  // namespace detail
+#endif  // DOXYGEN
+
+/*!
+ * \brief Approximation of the exponential function.
+ * \details Maximum error below 1.5 ULP for results within the range of normal numbers. As for `std::exp`, the
+ *          results over- and underflow to infinity and zero (via subnormal numbers) for large and small arguments.
+ *          The results for NaN arguments are unspecified.
+ */
+template<typename T> requires(std::is_arithmetic_v<T>)
+inline constexpr auto exp(T x) noexcept {
+    using F = detail::floating_point_for<T>;
+    using c = detail::constants<F>;
+    F k, r;
+    detail::reduce_exp_argument(detail::clamped(static_cast<F>(x), -c::min_exp_argument, c::max_exp_argument), k, r);
+    return detail::scaled(F{1} + detail::expm1_reduced(r), k);
+}
+
+/*!
+ * \brief Approximation of e^x - 1, which is accurate also for small arguments.
+ * \details Maximum error below 2.5 ULP for results within the range of normal numbers, which overflow to infinity
+ *          for large arguments as in `exp`.
+ */
+template<typename T> requires(std::is_arithmetic_v<T>)
+inline constexpr auto expm1(T x) noexcept {
+    using F = detail::floating_point_for<T>;
+    using c = detail::constants<F>;
+    F k, r;
+    detail::reduce_exp_argument(detail::clamped(static_cast<F>(x), -c::min_expm1_argument, c::max_exp_argument), k, r);
+    // 2^k*(e^r - 1 + 1 - 2^-k), which avoids inf - inf if 2^k overflows
+    return detail::scaled(detail::expm1_reduced(r) + (F{1} - detail::scaled(F{1}, -k)), k);
+}
+
+/*!
+ * \brief Approximation of the natural logarithm.
+ * \details Maximum error below 1.5 ULP for positive normal arguments. The results for zero, subnormal, negative or
+ *          non-finite arguments are unspecified.
+ */
+template<typename T> requires(std::is_arithmetic_v<T>)
+inline constexpr auto log(T x) noexcept {
+    using F = detail::floating_point_for<T>;
+    return detail::log_of_positive(static_cast<F>(x));
+}
+
+/*!
+ * \brief Approximation of a^b for positive a, computed as e^(b*log(a)).
+ * \details The error of the logarithm is amplified by |b*log(a)|, and the maximum relative error was measured to be
+ *          below (2 + 2|b*log(a)|) ULP. The results for non-positive or subnormal bases are unspecified.
+ */
+template<typename A, typename B> requires(std::is_arithmetic_v<A> and std::is_arithmetic_v<B>)
+inline constexpr auto pow(A a, B b) noexcept {
+    using F = detail::floating_point_for<std::common_type_t<A, B>>;
+    return fast_math::exp(static_cast<F>(b)*fast_math::log(static_cast<F>(a)));
+}
+
+/*!
+ * \brief Square root.
+ * \details Square roots are correctly rounded and map to a hardware instruction that compilers readily vectorize,
+ *          so that there is no benefit in approximating them. This simply forwards to `std::sqrt`.
+ */
+template<typename T> requires(std::is_arithmetic_v<T>)
+inline constexpr auto sqrt(T x) noexcept {
+    using F = detail::floating_point_for<T>;
+    return std::sqrt(static_cast<F>(x));
+}
+
+/*!
+ * \brief Approximation of the sine function.
+ * \details Maximum absolute error below 1 ULP of 1.0 for arguments within [-1e5, 1e5] (double) and [-1e4, 1e4]
+ *          (float), and maximum relative error below 2 ULP within [-4, 4]. The accuracy degrades for larger
+ *          arguments due to the simple range reduction.
+ */
+template<typename T> requires(std::is_arithmetic_v<T>)
+inline constexpr auto sin(T x) noexcept {
+    using F = detail::floating_point_for<T>;
+    F k, r;
+    detail::reduce_trigonometric_argument(static_cast<F>(x), k, r);
+    return detail::quadrant_value(k, detail::sin_reduced(r), detail::cos_reduced(r), 0);
+}
+
+/*!
+ * \brief Approximation of the cosine function.
+ * \details Same accuracy as `sin`.
+ */
+template<typename T> requires(std::is_arithmetic_v<T>)
+inline constexpr auto cos(T x) noexcept {
+    using F = detail::floating_point_for<T>;
+    F k, r;
+    detail::reduce_trigonometric_argument(static_cast<F>(x), k, r);
+    return detail::quadrant_value(k, detail::sin_reduced(r), detail::cos_reduced(r), 1);
+}
+
+/*!
+ * \brief Approximation of the hyperbolic tangent.
+ * \details Maximum error below 3 ULP for all finite arguments.
+ */
+template<typename T> requires(std::is_arithmetic_v<T>)
+inline constexpr auto tanh(T x) noexcept {
+    using F = detail::floating_point_for<T>;
+    const F a = static_cast<F>(x);
+    const F e = fast_math::expm1(F{-2}*detail::magnitude_of(a));
+    return detail::sign_flipped(-e/(F{2} + e), detail::sign_bits_of(a));
+}
+
+//! \} group Utilities
+
+}  // namespace xp::fast_math
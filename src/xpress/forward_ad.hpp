@@ -0,0 +1,301 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Expressions
+ * \brief Differentiation of expressions via forward-mode automatic differentiation with dual numbers.
+ */
+#pragma once
+
+#include <cmath>
+#include <compare>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "utils.hpp"
+#include "concepts.hpp"
+#include "traits.hpp"
+#include "type_traits.hpp"
+#include "bindings.hpp"
+#include "expressions.hpp"
+#include "operators.hpp"
+#include "cost.hpp"
+
+
+namespace xp {
+
+//! \addtogroup Expressions
+//! \{
+
+//! Dual number carrying a value and its derivative w.r.t. one variable
+template<typename T>
+struct dual {
+    T value;
+    T derivative;
+
+    constexpr dual() = default;
+    constexpr dual(T v, T d) noexcept : value{v}, derivative{d} {}
+
+    //! Construct a dual number representing a constant, e.g. for the selection between a constant and a variable
+    template<typename S> requires(std::is_arithmetic_v<S>)
+    constexpr dual(const S& v) noexcept : value{static_cast<T>(v)}, derivative{T{0}} {}
+
+    constexpr dual operator-() const noexcept { return {-value, -derivative}; }
+};
+
+template<typename T>
+dual(T, T) -> dual<T>;
+
+template<typename T> struct is_scalar<dual<T>> : std::true_type {};
+
+template<typename T>
+inline constexpr dual<T> operator+(const dual<T>& a, const dual<T>& b) noexcept {
+    return {a.value + b.value, a.derivative + b.derivative};
+}
+
+template<typename T>
+inline constexpr dual<T> operator-(const dual<T>& a, const dual<T>& b) noexcept {
+    return {a.value - b.value, a.derivative - b.derivative};
+}
+
+template<typename T>
+inline constexpr dual<T> operator*(const dual<T>& a, const dual<T>& b) noexcept {
+    return {a.value*b.value, a.derivative*b.value + a.value*b.derivative};
+}
+
+template<typename T>
+inline constexpr dual<T> operator/(const dual<T>& a, const dual<T>& b) noexcept {
+    return {a.value/b.value, a.derivative/b.value - a.value*b.derivative/(b.value*b.value)};
+}
+
+template<typename T, typename S> requires(std::is_arithmetic_v<S>)
+inline constexpr dual<T> operator+(const dual<T>& a, const S& b) noexcept { return a + dual<T>{T(b), T{0}}; }
+template<typename T, typename S> requires(std::is_arithmetic_v<S>)
+inline constexpr dual<T> operator+(const S& a, const dual<T>& b) noexcept { return dual<T>{T(a), T{0}} + b; }
+template<typename T, typename S> requires(std::is_arithmetic_v<S>)
+inline constexpr dual<T> operator-(const dual<T>& a, const S& b) noexcept { return a - dual<T>{T(b), T{0}}; }
+template<typename T, typename S> requires(std::is_arithmetic_v<S>)
+inline constexpr dual<T> operator-(const S& a, const dual<T>& b) noexcept { return dual<T>{T(a), T{0}} - b; }
+template<typename T, typename S> requires(std::is_arithmetic_v<S>)
+inline constexpr dual<T> operator*(const dual<T>& a, const S& b) noexcept { return {a.value*b, a.derivative*b}; }
+template<typename T, typename S> requires(std::is_arithmetic_v<S>)
+inline constexpr dual<T> operator*(const S& a, const dual<T>& b) noexcept { return {a*b.value, a*b.derivative}; }
+template<typename T, typename S> requires(std::is_arithmetic_v<S>)
+inline constexpr dual<T> operator/(const dual<T>& a, const S& b) noexcept { return {a.value/b, a.derivative/b}; }
+template<typename T, typename S> requires(std::is_arithmetic_v<S>)
+inline constexpr dual<T> operator/(const S& a, const dual<T>& b) noexcept { return dual<T>{T(a), T{0}}/b; }
+
+//! Dual numbers are ordered by their values, such that they can be used in conditional expressions
+template<typename T>
+inline constexpr auto operator<=>(const dual<T>& a, const dual<T>& b) noexcept { return a.value <=> b.value; }
+template<typename T, typename S> requires(std::is_arithmetic_v<S>)
+inline constexpr auto operator<=>(const dual<T>& a, const S& b) noexcept { return a.value <=> T(b); }
+
+
+namespace operators::traits {
+
+template<typename T>
+struct log_of<dual<T>> {
+    template<typename P = policy::precise>
+    constexpr dual<T> operator()(const dual<T>& a) const noexcept {
+        return {operators::log::with_policy<P>{}(a.value), a.derivative/a.value};
+    }
+};
+
+template<typename T>
+struct power_of<dual<T>, dual<T>> {
+    template<typename P = policy::precise>
+    constexpr dual<T> operator()(const dual<T>& a, const dual<T>& b) const noexcept {
+        // same as the symbolic derivative, where the second term vanishes for constant exponents
+        using pow = operators::pow::with_policy<P>;
+        const T value = pow{}(a.value, b.value);
+        const T d_a = b.value*pow{}(a.value, b.value - T{1})*a.derivative;
+        if (b.derivative == T{0})
+            return {value, d_a};
+        return {value, d_a + value*operators::log::with_policy<P>{}(a.value)*b.derivative};
+    }
+};
+
+template<typename T, typename S> requires(std::is_arithmetic_v<S>)
+struct power_of<dual<T>, S> {
+    template<typename P = policy::precise>
+    constexpr dual<T> operator()(const dual<T>& a, const S& b) const noexcept {
+        return power_of<dual<T>, dual<T>>{}.template operator()<P>(a, dual<T>{T(b), T{0}});
+    }
+};
+
+template<typename S, typename T> requires(std::is_arithmetic_v<S>)
+struct power_of<S, dual<T>> {
+    template<typename P = policy::precise>
+    constexpr dual<T> operator()(const S& a, const dual<T>& b) const noexcept {
+        return power_of<dual<T>, dual<T>>{}.template operator()<P>(dual<T>{T(a), T{0}}, b);
+    }
+};
+
+template<typename T>
+struct exp_of<dual<T>> {
+    template<typename P = policy::precise>
+    constexpr dual<T> operator()(const dual<T>& a) const noexcept {
+        const T value = operators::exp::with_policy<P>{}(a.value);
+        return {value, value*a.derivative};
+    }
+};
+
+template<typename T>
+struct sqrt_of<dual<T>> {
+    template<typename P = policy::precise>
+    constexpr dual<T> operator()(const dual<T>& a) const noexcept {
+        const T value = operators::sqrt::with_policy<P>{}(a.value);
+        return {value, a.derivative/(T{2}*value)};
+    }
+};
+
+template<typename T>
+struct sin_of<dual<T>> {
+    template<typename P = policy::precise>
+    constexpr dual<T> operator()(const dual<T>& a) const noexcept {
+        return {operators::sin::with_policy<P>{}(a.value), operators::cos::with_policy<P>{}(a.value)*a.derivative};
+    }
+};
+
+template<typename T>
+struct cos_of<dual<T>> {
+    template<typename P = policy::precise>
+    constexpr dual<T> operator()(const dual<T>& a) const noexcept {
+        return {operators::cos::with_policy<P>{}(a.value), -operators::sin::with_policy<P>{}(a.value)*a.derivative};
+    }
+};
+
+template<typename T>
+struct tanh_of<dual<T>> {
+    template<typename P = policy::precise>
+    constexpr dual<T> operator()(const dual<T>& a) const noexcept {
+        const T value = operators::tanh::with_policy<P>{}(a.value);
+        return {value, (T{1} - value*value)*a.derivative};
+    }
+};
+
+}  // namespace operators::traits
+
+
+//! Modes in which derivatives of expressions can be computed
+namespace differentiation {
+
+//! Evaluate the symbolically derived expression
+struct symbolic {};
+
+//! Evaluate the original expression once with dual numbers
+struct forward_ad {};
+
+//! Select the mode via traits::differentiation_mode
+struct automatic {};
+
+}  // namespace differentiation
+
+
+namespace traits {
+
+/*!
+ * \brief Largest estimated number of nodes (see traits::cost_of) of a first derivative for which
+ *        `differentiation::automatic` uses symbolic differentiation by default.
+ * \details Beyond this size, instantiating the derivative expression dominates the compile times, while forward
+ *          mode evaluates the original expression only once (with dual numbers).
+ */
+inline constexpr std::size_t max_symbolic_derivative_nodes = 128;
+
+/*!
+ * \brief Trait to select the mode in which `differentiation::automatic` computes derivatives of the given
+ *        expression w.r.t. the given variable. Can be specialized for particular expressions.
+ * \details The symbolic derivative of each product grows the expression, so expressions whose derivative is
+ *          estimated (see traits::cost_of) to have more than `max_symbolic_derivative_nodes` nodes are
+ *          differentiated in forward mode, which does not instantiate the derivative expression at all. Forward
+ *          mode only supports scalar-valued expressions.
+ */
+template<typename E, typename V>
+struct differentiation_mode : std::type_identity<std::conditional_t<
+    (!tensorial_expression<E> && cost_of<E>::value.derivative_nodes > max_symbolic_derivative_nodes),
+    differentiation::forward_ad,
+    differentiation::symbolic
+>> {};
+
+template<typename E, typename V>
+using differentiation_mode_t = typename differentiation_mode<E, V>::type;
+
+}  // namespace traits
+
+
+#ifndef DOXYGEN
+namespace detail {
+
+    template<typename T> struct is_dual : std::false_type {};
+    template<typename T> struct is_dual<dual<T>> : std::true_type {};
+
+    // true if all values are arithmetic, such that they can be seeded
+    template<typename... B>
+    inline constexpr bool has_arithmetic_values_v = std::conjunction_v<std::is_arithmetic<std::remove_cvref_t<
+        decltype(std::declval<const bindings<B...>&>()[typename B::symbol_type{}])
+    >>...>;
+
+    template<typename V, typename S, typename T>
+    constexpr auto seeded(const T& value) noexcept {
+        using scalar = std::conditional_t<std::is_floating_point_v<T>, T, double>;
+        return dual<scalar>{scalar(value), static_cast<scalar>(std::is_same_v<S, V> ? 1 : 0)};
+    }
+
+    template<typename T>
+    constexpr auto derivative_part_of(const T& value) noexcept {
+        static_assert(
+            is_dual<T>::value || std::is_arithmetic_v<T>,
+            "Forward-mode differentiation is only supported for scalar-valued expressions."
+        );
+        if constexpr (is_dual<T>::value)
+            return value.derivative;
+        else  // the expression does not depend on any of the bound values
+            return T{0};
+    }
+
+    template<typename V, typename... B>
+    constexpr auto dual_bindings_for(const bindings<B...>& values) noexcept {
+        static_assert(
+            has_arithmetic_values_v<B...>,
+            "Forward-mode differentiation is only supported for values bound to scalars."
+        );
+        return bindings{value_binder{
+            typename B::symbol_type{},
+            seeded<V, typename B::symbol_type>(values[typename B::symbol_type{}])
+        }...};
+    }
+
+}  // namespace detail
+#endif  // DOXYGEN
+
+/*!
+ * \brief Return the derivative of the given expression w.r.t the given variable, evaluated at the given values,
+ *        using the given differentiation mode.
+ * \note Forward mode only supports scalar-valued expressions of scalar values, and `differentiation::automatic`
+ *       falls back to symbolic differentiation if any of the values is not a scalar.
+ */
+template<typename mode, expression E, typename V, typename... B>
+    requires(is_any_of_v<mode, differentiation::symbolic, differentiation::forward_ad, differentiation::automatic>)
+inline constexpr auto derivative_of(const E& expr, const type_list<V>& var, const bindings<B...>& vals) noexcept {
+    if constexpr (std::is_same_v<mode, differentiation::automatic> && !detail::has_arithmetic_values_v<B...>)
+        return derivative_of(expr, var, vals);
+    else if constexpr (std::is_same_v<mode, differentiation::automatic>)
+        return derivative_of<traits::differentiation_mode_t<E, V>>(expr, var, vals);
+    else if constexpr (std::is_same_v<mode, differentiation::symbolic>)
+        return derivative_of(expr, var, vals);
+    else
+        return detail::derivative_part_of(value_of(expr, detail::dual_bindings_for<V>(vals)));
+}
+
+//! \} group Expressions
+
+}  // namespace xp
+
+
+//! Dual numbers and scalars have a dual number as common type (e.g. in selections between constants and variables)
+template<typename T, typename S> requires(std::is_arithmetic_v<S>)
+struct std::common_type<xp::dual<T>, S> : std::type_identity<xp::dual<T>> {};
+template<typename S, typename T> requires(std::is_arithmetic_v<S>)
+struct std::common_type<S, xp::dual<T>> : std::type_identity<xp::dual<T>> {};
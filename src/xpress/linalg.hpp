@@ -11,11 +11,15 @@
 #include <type_traits>
 #include <algorithm>
 #include <array>
+#include <functional>
+#include <optional>
 #include <tuple>
+#include <utility>
 
 #include "utils.hpp"
 #include "traits.hpp"
 #include "concepts.hpp"
+#include "values.hpp"
 
 
 namespace xp::linalg {
@@ -116,7 +120,256 @@ template<std::size_t... s, typename... Ts>
 tensor(const md_shape<s...>&, Ts&&...) -> tensor<std::remove_cvref_t<first_t<type_list<Ts...>>>, md_shape<s...>>;
 
 
-//! Compute the matrix product of two tensors
+/*!
+ * \brief Symmetric n x n matrix that only stores its n*(n+1)/2 independent entries.
+ * \details The entries are packed in Voigt order, that is, the diagonal first, followed by the off-diagonal
+ *          entries (1, 2), (0, 2), (0, 1) for n = 3, or (0, 1) for n = 2. Writing to entry (i, j) thus also
+ *          changes entry (j, i).
+ */
+template<typename T, std::size_t n>
+struct symmetric_tensor {
+    static constexpr std::size_t voigt_size = n*(n+1)/2;
+
+    constexpr symmetric_tensor() = default;
+    constexpr symmetric_tensor(T value) noexcept { std::ranges::fill(_values, value); }
+
+    //! Construct from the entries in Voigt order
+    constexpr symmetric_tensor(std::array<T, voigt_size>&& values) noexcept
+    : _values{std::move(values)}
+    {}
+
+    //! Construct from the entries in Voigt order
+    template<std::convertible_to<T>... _T> requires(voigt_size > 1 and sizeof...(_T) == voigt_size)
+    constexpr symmetric_tensor(_T&&... values) noexcept
+    : _values{static_cast<T>(std::forward<_T>(values))...}
+    {}
+
+    //! Return the position of entry (i, j) in the Voigt-ordered storage
+    static constexpr std::size_t voigt_index(std::size_t i, std::size_t j) noexcept {
+        if (i > j)
+            std::swap(i, j);
+        if (i == j)
+            return i;
+        std::size_t idx = n;
+        for (std::size_t r = n - 1; r-- > 0;)
+            for (std::size_t c = n; c-- > r + 1; ++idx)
+                if (r == i && c == j)
+                    return idx;
+        return idx;
+    }
+
+    template<typename S, std::size_t i, std::size_t j>
+    constexpr decltype(auto) operator[](this S&& self, const md_index<i, j>&) noexcept {
+        static_assert(i < n && j < n, "Index out of bounds.");
+        return self._values[std::integral_constant<std::size_t, voigt_index(i, j)>::value];
+    }
+
+    template<typename S, std::integral I, std::integral J>
+    constexpr decltype(auto) operator[](this S&& self, const I& i, const J& j) noexcept {
+        return self._values[voigt_index(i, j)];
+    }
+
+    //! Return the entries in Voigt order
+    template<typename S>
+    constexpr decltype(auto) voigt(this S&& self) noexcept {
+        return (self._values);
+    }
+
+    template<typename T2>
+    constexpr bool operator==(const symmetric_tensor<T2, n>& other) const noexcept {
+        return std::ranges::equal(_values, other.voigt());
+    }
+
+    template<typename T2>
+    constexpr bool operator==(const tensor<T2, md_shape<n, n>>& other) const noexcept {
+        bool all_equal = true;
+        visit_indices_in(md_shape<n, n>{}, [&] (const auto& idx) constexpr {
+            if ((*this)[idx] != other[idx])
+                all_equal = false;
+        });
+        return all_equal;
+    }
+
+ private:
+    std::array<T, voigt_size> _values;
+};
+
+
+//! Marks the entries of a structured_tensor whose values are only known at runtime
+struct stored_entry {};
+
+/*!
+ * \brief Tensor whose entries are partly known at compile time, e.g. the values of derivative expressions.
+ * \details The pattern is a list with one entry per tensor entry (in row-major order), which is either a constant
+ *          `value<v>` or `stored_entry`. Only the latter are stored, while accessing the former yields the constant.
+ *          Algebraic kernels use the pattern to skip the terms involving structural zeros.
+ */
+template<typename T, typename shape, typename pattern>
+struct structured_tensor;
+
+template<typename T, typename shape, typename... P> requires(sizeof...(P) == shape::count)
+struct structured_tensor<T, shape, type_list<P...>> {
+    static constexpr std::array<bool, shape::count> is_stored{std::is_same_v<P, stored_entry>...};
+    static constexpr std::array<bool, shape::count> is_zero{traits::is_zero_value_v<P>...};
+    static constexpr std::size_t stored_count = std::ranges::count(is_stored, true);
+
+    constexpr structured_tensor() = default;
+    constexpr structured_tensor(T value) noexcept { std::ranges::fill(_values, value); }
+
+    //! Construct from the stored entries
+    constexpr structured_tensor(std::array<T, stored_count>&& values) noexcept
+    : _values{std::move(values)}
+    {}
+
+    //! Construct from all entries, of which only the ones not known at compile time are stored
+    constexpr structured_tensor(const shape&, const std::array<T, shape::count>& values) noexcept
+    : _values{}
+    {
+        for (std::size_t i = 0; i < shape::count; ++i)
+            if (is_stored[i])
+                _values[_slots[i]] = values[i];
+    }
+
+    template<typename S, std::size_t... i>
+    constexpr decltype(auto) operator[](this S&& self, const md_index<i...>&) noexcept {
+        constexpr std::size_t flat = md_index<i...>::as_flat_index_in(shape{}).value;
+        static_assert(flat < shape::count);
+        if constexpr (is_stored[flat])
+            return self._values[_slots[flat]];
+        else
+            return T{_constants[flat]};
+    }
+
+    template<typename S, std::size_t i> requires(shape::dimensions == 1)
+    constexpr decltype(auto) operator[](this S&& self, const index_constant<i>&) noexcept {
+        return self[md_ic<i>];
+    }
+
+    template<std::integral... is> requires(sizeof...(is) == shape::dimensions)
+    constexpr T operator[](const is&... indices) const noexcept {
+        const std::size_t flat = [&] <std::size_t... s> (const md_shape<s...>&) {
+            std::size_t result = 0;
+            ((result = result*s + static_cast<std::size_t>(indices)), ...);
+            return result;
+        } (shape{});
+        return is_stored[flat] ? _values[_slots[flat]] : _constants[flat];
+    }
+
+    //! Return the stored entries
+    template<typename S>
+    constexpr decltype(auto) stored(this S&& self) noexcept {
+        return (self._values);
+    }
+
+    template<tensorial O> requires(!std::is_same_v<O, structured_tensor>)
+    constexpr bool operator==(const O& other) const noexcept {
+        return _equals(other);
+    }
+
+    constexpr bool operator==(const structured_tensor& other) const noexcept {
+        return _equals(other);
+    }
+
+ private:
+    template<typename O>
+    constexpr bool _equals(const O& other) const noexcept {
+        if constexpr (shape_of_t<O>{} != shape{}) {
+            return false;
+        } else {
+            bool all_equal = true;
+            visit_indices_in(shape{}, [&] (const auto& idx) constexpr {
+                if ((*this)[idx] != access<O>::at(idx, other))
+                    all_equal = false;
+            });
+            return all_equal;
+        }
+    }
+
+    static constexpr std::array<std::size_t, shape::count> _slots = [] () {
+        std::array<std::size_t, shape::count> slots{};
+        for (std::size_t i = 0, slot = 0; i < shape::count; ++i)
+            slots[i] = is_stored[i] ? slot++ : stored_count;
+        return slots;
+    } ();
+
+    static constexpr std::array<T, shape::count> _constants{
+        static_cast<T>(traits::value_of<std::conditional_t<std::is_same_v<P, stored_entry>, value<0>, P>>::from(
+            bindings<>{}
+        ))...
+    };
+
+    std::array<T, stored_count> _values;
+};
+
+//! Compile-time mask of the entries of the given tensor type that are structurally zero
+template<typename T>
+inline constexpr std::array<bool, shape_of_t<T>::count> structural_zeros_v{};
+template<typename T, typename shape, typename pattern>
+inline constexpr auto structural_zeros_v<structured_tensor<T, shape, pattern>>
+    = structured_tensor<T, shape, pattern>::is_zero;
+
+//! Evaluates to true if the entry at the given index (of type md_index) is structurally zero in tensors of type T
+template<typename T, typename index>
+inline constexpr bool is_structural_zero_v = structural_zeros_v<T>[index::as_flat_index_in(shape_of_t<T>{}).value];
+
+#ifndef DOXYGEN
+namespace detail {
+
+    template<typename T, typename shape, auto zeros, typename = std::make_index_sequence<shape::count>>
+    struct masked_tensor;
+    template<typename T, typename shape, auto zeros, std::size_t... k>
+    struct masked_tensor<T, shape, zeros, std::index_sequence<k...>> {
+        using type = structured_tensor<T, shape, type_list<std::conditional_t<zeros[k], value<0>, stored_entry>...>>;
+    };
+
+}  // namespace detail
+#endif  // DOXYGEN
+
+//! Tensor type with the given structural zeros, which is dense if there are none
+template<typename T, typename shape, auto zeros>
+using masked_tensor_t = std::conditional_t<
+    std::ranges::any_of(zeros, std::identity{}),
+    typename detail::masked_tensor<T, shape, zeros>::type,
+    tensor<T, shape>
+>;
+
+#ifndef DOXYGEN
+namespace detail {
+
+    template<typename T1, typename T2, std::size_t... i>
+    struct mat_mul_term {
+        using shape1 = shape_of_t<T1>;
+        template<std::size_t j>
+        using first = decltype(md_index{values<i...>::template take<shape1::dimensions-1>() + values<j>{}});
+        template<std::size_t j>
+        using second = decltype(md_index{values<j>{} + values<i...>::template drop<shape1::dimensions-1>()});
+        template<std::size_t j>
+        static constexpr bool is_zero = is_structural_zero_v<T1, first<j>> or is_structural_zero_v<T2, second<j>>;
+    };
+
+    // mask of the entries of a matrix product in which all terms involve structural zeros
+    template<typename T1, typename T2, typename result_shape>
+    constexpr auto mat_mul_zeros() noexcept {
+        std::array<bool, result_shape::count> zeros{};
+        visit_indices_in(result_shape{}, [&] <std::size_t... i> (const md_index<i...>& idx) constexpr {
+            bool all_zero = true;
+            visit_indices_in(shape<shape_of_t<T1>{}.last()>, [&] <std::size_t j> (const md_index<j>&) constexpr {
+                if (!mat_mul_term<T1, T2, i...>::template is_zero<j>)
+                    all_zero = false;
+            });
+            zeros[idx.as_flat_index_in(result_shape{}).value] = all_zero;
+        });
+        return zeros;
+    }
+
+}  // namespace detail
+#endif  // DOXYGEN
+
+/*!
+ * \brief Compute the matrix product of two tensors.
+ * \details Terms involving structural zeros of the operands are skipped. If this leaves entries of the
+ *          product without any terms, the product is returned as structured_tensor.
+ */
 template<tensorial T1, tensorial T2>
 inline constexpr auto mat_mul(const T1& t1, const T2& t2) noexcept {
     using shape1 = shape_of_t<T1>;
@@ -129,19 +382,31 @@ inline constexpr auto mat_mul(const T1& t1, const T2& t2) noexcept {
         + typename shape2::as_values_t{}.template drop<1>()
     };
 
-    // todo: deduce return tensor type somehow?
     using scalar = std::common_type_t<scalar_type_t<T1>, scalar_type_t<T2>>;
-    linalg::tensor<scalar, decltype(new_shape)> result{scalar{0}};
+    using new_shape_t = std::remove_const_t<decltype(new_shape)>;
+    masked_tensor_t<scalar, new_shape_t, detail::mat_mul_zeros<T1, T2, new_shape_t>()> result{scalar{0}};
     visit_indices_in(new_shape, [&] <std::size_t... i> (const md_index<i...>& idx) constexpr {
+        using term = detail::mat_mul_term<T1, T2, i...>;
         visit_indices_in(shape<shape1{}.last()>, [&] <std::size_t j> (const md_index<j>&) constexpr {
-            const auto t1_idx = md_index{values<i...>::template take<shape1::dimensions-1>() + values<j>{}};
-            const auto t2_idx = md_index{values<j>{} + values<i...>::template drop<shape1::dimensions-1>()};
-            result[idx] += access<T1>::at(t1_idx, t1)*access<T2>::at(t2_idx, t2);
+            if constexpr (!term::template is_zero<j>)
+                result[idx] += access<T1>::at(typename term::template first<j>{}, t1)
+                    *access<T2>::at(typename term::template second<j>{}, t2);
         });
     });
     return result;
 }
 
+//! Return a dense copy of the given tensor, with entries converted to the given scalar type
+template<typename S, tensorial T>
+inline constexpr auto dense_copy_of(const T& t) noexcept {
+    using shape = shape_of_t<T>;
+    linalg::tensor<S, shape> result{};
+    visit_indices_in(shape{}, [&] (const auto& idx) constexpr {
+        result[idx] = static_cast<S>(access<T>::at(idx, t));
+    });
+    return result;
+}
+
 //! Return the determinant of the given tensor
 template<tensorial T>
     requires(shape_of_t<T>{}.dimensions == 2)
@@ -166,6 +431,250 @@ inline constexpr auto determinant_of(const T& tensor) noexcept {
             - _get(at<0, 0>())*_get(at<1, 2>())*_get(at<2, 1>());
 }
 
+//! Return the transpose of the given matrix
+template<tensorial T>
+    requires(shape_of_t<T>{}.dimensions == 2)
+inline constexpr auto transpose_of(const T& tensor) noexcept {
+    using shape = shape_of_t<T>;
+    linalg::tensor<scalar_type_t<T>, md_shape<shape::last(), shape::first()>> result{};
+    visit_indices_in(shape{}, [&] <std::size_t i, std::size_t j> (const md_index<i, j>& idx) constexpr {
+        result[md_ic<j, i>] = access<T>::at(idx, tensor);
+    });
+    return result;
+}
+
+//! Return the trace of the given matrix
+template<tensorial T>
+    requires(shape_of_t<T>{}.dimensions == 2)
+inline constexpr auto trace_of(const T& tensor) noexcept {
+    using shape = shape_of_t<T>;
+    static_assert(shape::is_square, "Trace can only be computed for square matrices.");
+    return [&] <std::size_t... i> (std::index_sequence<i...>) constexpr {
+        return (access<T>::at(md_ic<i, i>, tensor) + ...);
+    } (std::make_index_sequence<shape::first()>{});
+}
+
+/*!
+ * \brief Return the inverse of the given matrix.
+ * \details 2x2 and 3x3 matrices are inverted in closed form via their adjugate, larger ones via Gauss-Jordan
+ *          elimination with partial pivoting. The matrix is assumed to be invertible. Integral matrices yield
+ *          an inverse with `double` entries.
+ */
+template<tensorial T>
+    requires(shape_of_t<T>{}.dimensions == 2)
+inline constexpr auto inverse_of(const T& t) noexcept {
+    using shape = shape_of_t<T>;
+    using scalar = std::conditional_t<std::is_integral_v<scalar_type_t<T>>, double, scalar_type_t<T>>;
+    static_assert(shape::is_square, "Inverse can only be computed for square matrices.");
+    constexpr std::size_t n = shape::first();
+
+    const auto _get = [&] <std::size_t i, std::size_t j> (const md_index<i, j>& idx) constexpr noexcept {
+        return static_cast<scalar>(access<T>::at(idx, t));
+    };
+
+    if constexpr (n == 1) {
+        return tensor{shape{}, scalar{1}/_get(at<0, 0>())};
+    } else if constexpr (n == 2) {
+        const auto a = _get(at<0, 0>()); const auto b = _get(at<0, 1>());
+        const auto c = _get(at<1, 0>()); const auto d = _get(at<1, 1>());
+        const scalar inv_det = scalar{1}/(a*d - b*c);
+        return tensor{shape{}, d*inv_det, -b*inv_det, -c*inv_det, a*inv_det};
+    } else if constexpr (n == 3) {
+        const auto a = _get(at<0, 0>()); const auto b = _get(at<0, 1>()); const auto c = _get(at<0, 2>());
+        const auto d = _get(at<1, 0>()); const auto e = _get(at<1, 1>()); const auto f = _get(at<1, 2>());
+        const auto g = _get(at<2, 0>()); const auto h = _get(at<2, 1>()); const auto i = _get(at<2, 2>());
+        const scalar cof_00 = e*i - f*h;
+        const scalar cof_01 = f*g - d*i;
+        const scalar cof_02 = d*h - e*g;
+        const scalar inv_det = scalar{1}/(a*cof_00 + b*cof_01 + c*cof_02);
+        return tensor{shape{},
+            cof_00*inv_det, (c*h - b*i)*inv_det, (b*f - c*e)*inv_det,
+            cof_01*inv_det, (a*i - c*g)*inv_det, (c*d - a*f)*inv_det,
+            cof_02*inv_det, (b*g - a*h)*inv_det, (a*e - b*d)*inv_det
+        };
+    } else {
+        const auto _abs = [] (const scalar& x) constexpr { return x < scalar{0} ? -x : x; };
+        tensor<scalar, shape> lu{};
+        tensor<scalar, shape> result{scalar{0}};
+        visit_indices_in(shape{}, [&] (const auto& idx) constexpr { lu[idx] = _get(idx); });
+        for (std::size_t i = 0; i < n; ++i)
+            result[i, i] = scalar{1};
+        for (std::size_t col = 0; col < n; ++col) {
+            std::size_t pivot = col;
+            for (std::size_t row = col + 1; row < n; ++row)
+                if (_abs(lu[row, col]) > _abs(lu[pivot, col]))
+                    pivot = row;
+            if (pivot != col)
+                for (std::size_t k = 0; k < n; ++k) {
+                    std::swap(lu[pivot, k], lu[col, k]);
+                    std::swap(result[pivot, k], result[col, k]);
+                }
+            const scalar inv_pivot = scalar{1}/lu[col, col];
+            for (std::size_t k = 0; k < n; ++k) {
+                lu[col, k] *= inv_pivot;
+                result[col, k] *= inv_pivot;
+            }
+            for (std::size_t row = 0; row < n; ++row) {
+                if (row == col)
+                    continue;
+                const scalar factor = lu[row, col];
+                for (std::size_t k = 0; k < n; ++k) {
+                    lu[row, k] -= factor*lu[col, k];
+                    result[row, k] -= factor*result[col, k];
+                }
+            }
+        }
+        return result;
+    }
+}
+
+//! Return the determinant of the given symmetric matrix, reusing the entries shared by both triangles
+template<typename T, std::size_t n>
+inline constexpr auto determinant_of(const symmetric_tensor<T, n>& t) noexcept {
+    static_assert(n == 2 || n == 3, "Determinant is only implemented for 2x2 & 3x3 matrices.");
+    const auto& v = t.voigt();
+    if constexpr (n == 2)
+        return v[0]*v[1] - v[2]*v[2];
+    else
+        return v[0]*(v[1]*v[2] - v[3]*v[3])
+            - v[5]*(v[5]*v[2] - v[3]*v[4])
+            + v[4]*(v[5]*v[3] - v[1]*v[4]);
+}
+
+//! Return the transpose of the given symmetric matrix, i.e. the matrix itself
+template<typename T, std::size_t n>
+inline constexpr const symmetric_tensor<T, n>& transpose_of(const symmetric_tensor<T, n>& t) noexcept {
+    return t;
+}
+
+//! Return the inverse of the given symmetric matrix, which is again symmetric
+template<typename T, std::size_t n>
+    requires(n == 2 || n == 3)
+inline constexpr auto inverse_of(const symmetric_tensor<T, n>& t) noexcept {
+    using scalar = std::conditional_t<std::is_integral_v<T>, double, T>;
+    const auto& v = t.voigt();
+    if constexpr (n == 2) {
+        const scalar inv_det = scalar{1}/(v[0]*v[1] - v[2]*v[2]);
+        return symmetric_tensor<scalar, 2>{v[1]*inv_det, v[0]*inv_det, -v[2]*inv_det};
+    } else {
+        const scalar cof_00 = v[1]*v[2] - v[3]*v[3];
+        const scalar cof_11 = v[0]*v[2] - v[4]*v[4];
+        const scalar cof_22 = v[0]*v[1] - v[5]*v[5];
+        const scalar cof_12 = v[4]*v[5] - v[0]*v[3];
+        const scalar cof_02 = v[5]*v[3] - v[1]*v[4];
+        const scalar cof_01 = v[3]*v[4] - v[5]*v[2];
+        const scalar inv_det = scalar{1}/(v[0]*cof_00 + v[5]*cof_01 + v[4]*cof_02);
+        return symmetric_tensor<scalar, 3>{
+            cof_00*inv_det, cof_11*inv_det, cof_22*inv_det,
+            cof_12*inv_det, cof_02*inv_det, cof_01*inv_det
+        };
+    }
+}
+
+/*!
+ * \brief Solve the system `A x = b` with the symmetric positive-definite matrix `A` via its Cholesky factorization.
+ * \details Uses the square-root-free variant `A = L D L^T` and only reads the lower triangle of `A`. Returns an
+ *          empty optional if `A` is not (numerically) positive definite.
+ */
+template<tensorial T, tensorial B>
+    requires(shape_of_t<T>{}.dimensions == 2 and shape_of_t<B>{}.dimensions == 1)
+inline constexpr auto cholesky_solve(const T& A, const B& b) noexcept {
+    using shape = shape_of_t<T>;
+    using scalar = std::conditional_t<
+        std::is_integral_v<std::common_type_t<scalar_type_t<T>, scalar_type_t<B>>>,
+        double,
+        std::common_type_t<scalar_type_t<T>, scalar_type_t<B>>
+    >;
+    static_assert(shape::is_square, "Cholesky factorization requires a square matrix.");
+    constexpr std::size_t n = shape::first();
+    static_assert(shape_of_t<B>::first() == n, "Dimension mismatch between matrix and right-hand side.");
+    using result_t = std::optional<tensor<scalar, md_shape<n>>>;
+
+    std::array<scalar, n*n> ld{};
+    visit_indices_in(shape{}, [&] <std::size_t i, std::size_t j> (const md_index<i, j>& idx) constexpr {
+        if constexpr (j <= i)
+            ld[i*n + j] = static_cast<scalar>(access<T>::at(idx, A));
+    });
+    for (std::size_t j = 0; j < n; ++j) {
+        for (std::size_t k = 0; k < j; ++k)
+            ld[j*n + j] -= ld[j*n + k]*ld[j*n + k]*ld[k*n + k];
+        if (!(ld[j*n + j] > scalar{0}))
+            return result_t{};
+        for (std::size_t i = j + 1; i < n; ++i) {
+            for (std::size_t k = 0; k < j; ++k)
+                ld[i*n + j] -= ld[i*n + k]*ld[j*n + k]*ld[k*n + k];
+            ld[i*n + j] /= ld[j*n + j];
+        }
+    }
+
+    tensor<scalar, md_shape<n>> x{};
+    visit_indices_in(md_shape<n>{}, [&] <std::size_t i> (const md_index<i>& idx) constexpr {
+        x[i] = static_cast<scalar>(access<B>::at(idx, b));
+    });
+    for (std::size_t i = 0; i < n; ++i)
+        for (std::size_t k = 0; k < i; ++k)
+            x[i] -= ld[i*n + k]*x[k];
+    for (std::size_t i = 0; i < n; ++i)
+        x[i] /= ld[i*n + i];
+    for (std::size_t i = n; i-- > 0;)
+        for (std::size_t k = i + 1; k < n; ++k)
+            x[i] -= ld[k*n + i]*x[k];
+    return result_t{std::move(x)};
+}
+
+//! Return the double contraction A:B of two symmetric matrices, visiting each off-diagonal pair only once
+template<typename T1, typename T2, std::size_t n>
+inline constexpr auto double_contraction_of(const symmetric_tensor<T1, n>& a,
+                                            const symmetric_tensor<T2, n>& b) noexcept {
+    using scalar = std::common_type_t<T1, T2>;
+    scalar diagonal{0};
+    scalar off_diagonal{0};
+    for (std::size_t i = 0; i < n; ++i)
+        diagonal += a.voigt()[i]*b.voigt()[i];
+    for (std::size_t i = n; i < symmetric_tensor<T1, n>::voigt_size; ++i)
+        off_diagonal += a.voigt()[i]*b.voigt()[i];
+    return diagonal + scalar{2}*off_diagonal;
+}
+
+//! Apply the given operator to the Voigt entries of two symmetric matrices, yielding a symmetric matrix
+template<typename T1, typename T2, std::size_t n, typename op>
+inline constexpr auto voigt_transform(const symmetric_tensor<T1, n>& a,
+                                      const symmetric_tensor<T2, n>& b,
+                                      const op& operation) noexcept {
+    using scalar = std::common_type_t<T1, T2>;
+    std::array<scalar, symmetric_tensor<T1, n>::voigt_size> result;
+    std::ranges::transform(a.voigt(), b.voigt(), result.begin(), operation);
+    return symmetric_tensor<scalar, n>{std::move(result)};
+}
+
+#ifndef DOXYGEN
+namespace detail {
+
+    template<typename op, typename P1, typename P2>
+    struct transformed_entry : std::type_identity<stored_entry> {};
+    template<typename op, auto v1, auto v2>
+    struct transformed_entry<op, value<v1>, value<v2>> : std::type_identity<value<op{}(v1, v2)>> {};
+
+}  // namespace detail
+#endif  // DOXYGEN
+
+//! Apply the given binary operation entry-wise on two structured tensors, folding the entries known at compile time
+template<typename T1, typename T2, typename shape, typename... P1, typename... P2, typename op>
+inline constexpr auto structured_transform(const structured_tensor<T1, shape, type_list<P1...>>& a,
+                                           const structured_tensor<T2, shape, type_list<P2...>>& b,
+                                           const op& operation) noexcept {
+    using scalar = std::common_type_t<T1, T2>;
+    using pattern = type_list<typename detail::transformed_entry<op, P1, P2>::type...>;
+    using result = structured_tensor<scalar, shape, pattern>;
+    std::array<scalar, shape::count> values{};
+    visit_indices_in(shape{}, [&] <std::size_t... i> (const md_index<i...>& idx) constexpr {
+        constexpr std::size_t flat = md_index<i...>::as_flat_index_in(shape{}).value;
+        if constexpr (result::is_stored[flat])
+            values[flat] = operation(a[idx], b[idx]);
+    });
+    return result{shape{}, values};
+}
+
 //! \} group LinearAlgebra
 
 }  // namespace xp::linalg
@@ -174,6 +683,10 @@ namespace xp {
 
 template<typename T, typename shape>  // TODO: constrain on scalar T
 struct scalar_type<linalg::tensor<T, shape>> : std::type_identity<T> {};
+template<typename T, std::size_t n>
+struct scalar_type<linalg::symmetric_tensor<T, n>> : std::type_identity<T> {};
+template<typename T, typename shape, typename pattern>
+struct scalar_type<linalg::structured_tensor<T, shape, pattern>> : std::type_identity<T> {};
 
 #ifndef DOXYGEN
 namespace detail {
@@ -208,6 +721,10 @@ template<typename T> requires(is_indexable_v<T> and is_complete_v<detail::size_o
 struct shape_of<T> : detail::shape_of_indexable<T> {};
 template<typename T, typename shape>
 struct shape_of<linalg::tensor<T, shape>> : std::type_identity<shape> {};
+template<typename T, std::size_t n>
+struct shape_of<linalg::symmetric_tensor<T, n>> : std::type_identity<md_shape<n, n>> {};
+template<typename T, typename shape, typename pattern>
+struct shape_of<linalg::structured_tensor<T, shape, pattern>> : std::type_identity<shape> {};
 template<typename T>
 using shape_of_t = typename shape_of<T>::type;
 
@@ -220,6 +737,20 @@ struct access<linalg::tensor<T, shape>> {
         return tensor[idx];
     }
 };
+template<typename T, std::size_t n>
+struct access<linalg::symmetric_tensor<T, n>> {
+    template<same_remove_cvref_t_as<linalg::symmetric_tensor<T, n>> _T, std::size_t i, std::size_t j>
+    static constexpr decltype(auto) at(const md_index<i, j>& idx, _T&& tensor) noexcept {
+        return tensor[idx];
+    }
+};
+template<typename T, typename shape, typename pattern>
+struct access<linalg::structured_tensor<T, shape, pattern>> {
+    template<same_remove_cvref_t_as<linalg::structured_tensor<T, shape, pattern>> _T, std::size_t... i>
+    static constexpr decltype(auto) at(const md_index<i...>& idx, _T&& tensor) noexcept {
+        return tensor[idx];
+    }
+};
 template<typename T> requires(is_indexable_v<T> and is_complete_v<shape_of<T>>)
 struct access<T> {
     template<same_remove_cvref_t_as<T> _T, std::size_t... i> requires(sizeof...(i) == shape_of_t<T>::dimensions)
@@ -15,10 +15,21 @@
 #include "operators/divide.hpp"
 #include "operators/pow.hpp"
 #include "operators/log.hpp"
+#include "operators/exp.hpp"
+#include "operators/sqrt.hpp"
+#include "operators/sin.hpp"
+#include "operators/cos.hpp"
+#include "operators/tanh.hpp"
+#include "operators/compare.hpp"
+#include "operators/select.hpp"
 
 // operators on tensors
 #include "operators/det.hpp"
 #include "operators/mat_mul.hpp"
+#include "operators/contract.hpp"
+#include "operators/transpose.hpp"
+#include "operators/trace.hpp"
+#include "operators/inverse.hpp"
 
 
 namespace xp {
@@ -7,10 +7,13 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <type_traits>
 
 #include "../utils.hpp"
 #include "../traits.hpp"
+#include "../policy.hpp"
+#include "../linalg.hpp"
 
 
 namespace xp {
@@ -20,16 +23,38 @@ namespace xp {
 
 namespace operators {
 
+//! Categories of operators, used e.g. to select the working type of operators (see policy::mixed_precision)
+namespace category {
+
+struct accumulation {};  //!< operators that accumulate values, e.g. sums or matrix products
+struct elementwise {};   //!< all other operators
+
+}  // namespace category
+
 namespace traits {
 
+//! Trait to specify the category of an operator
+template<typename op>
+struct category_of : std::type_identity<category::elementwise> {};
+
 template<typename op>
 struct is_commutative : std::false_type {};
 
+template<typename op>
+struct is_associative : std::false_type {};
+
+//! Trait to specify the relative cost of evaluating an operator, in units of scalar additions
+template<typename op>
+struct cost : std::integral_constant<std::size_t, 1> {};
+
 }  // namespace traits
 
 template<typename op>
 inline constexpr bool is_commutative_v = traits::is_commutative<op>::value;
 
+template<typename op>
+inline constexpr bool is_associative_v = traits::is_associative<op>::value;
+
 //! Base class that may be reused by operator implementations
 template<template<typename...> typename trait, typename default_operator>
 struct operator_base {
@@ -48,6 +73,33 @@ struct operator_base {
     }
 };
 
+/*!
+ * \brief Base class for operators whose default implementation depends on a policy (see policy.hpp).
+ * \details The operator with a different policy is obtained via `with_policy`. Specializations of the trait may
+ *          receive the policy as first template argument of their call operator, which is how the default
+ *          specializations for tensors forward it to the operations on their entries.
+ */
+template<template<typename...> typename trait,
+         template<typename> typename default_operator,
+         typename P = policy::precise>
+struct policy_operator_base {
+    template<typename _P>
+    using with_policy = policy_operator_base<trait, default_operator, _P>;
+
+    template<typename... T>
+    constexpr decltype(auto) operator()(T&&... t) const noexcept {
+        using specialization = trait<std::remove_cvref_t<T>...>;
+        if constexpr (is_complete_v<specialization>) {
+            if constexpr (requires { specialization{}.template operator()<P>(std::declval<T>()...); })
+                return specialization{}.template operator()<P>(std::forward<T>(t)...);
+            else
+                return specialization{}(std::forward<T>(t)...);
+        } else {
+            return operator_base<trait, default_operator<P>>{}(std::forward<T>(t)...);
+        }
+    }
+};
+
 }  // namespace operators
 
 //! Represents an expression resulting from an operator applied to the given terms
@@ -63,11 +115,157 @@ template<typename op, typename... Ts>
 operation(op&&, Ts&&...) -> operation<std::remove_cvref_t<op>, std::remove_cvref_t<Ts>...>;
 
 
+#ifndef DOXYGEN
+namespace detail {
+
+    template<typename op, typename P>
+    struct with_policy : std::type_identity<op> {};
+    template<typename op, typename P> requires(requires { typename op::template with_policy<P>; })
+    struct with_policy<op, P> : std::type_identity<typename op::template with_policy<P>> {};
+
+    template<typename W, typename T>
+    constexpr decltype(auto) converted_to(T&& t) noexcept {
+        using value_type = std::remove_cvref_t<T>;
+        if constexpr (std::is_arithmetic_v<value_type>)
+            return static_cast<W>(t);
+        else if constexpr (tensorial<value_type> and std::is_arithmetic_v<scalar_type_t<value_type>>) {
+            using shape = shape_of_t<value_type>;
+            linalg::tensor<W, shape> result{};
+            visit_indices_in(shape{}, [&] (const auto& idx) {
+                result[idx] = static_cast<W>(access<value_type>::at(idx, t));
+            });
+            return result;
+        } else {
+            return std::forward<T>(t);
+        }
+    }
+
+    // evaluates the given operator after converting the operands to the given working type
+    template<typename op, typename W>
+    struct working_precision_operator {
+        template<typename... T>
+        constexpr decltype(auto) operator()(T&&... t) const noexcept {
+            return op{}(converted_to<W>(std::forward<T>(t))...);
+        }
+    };
+
+    template<typename op, typename P>
+    struct with_evaluation_policy : with_policy<op, P> {};
+    template<typename op, typename A, typename E, typename P>
+    struct with_evaluation_policy<op, policy::mixed_precision<A, E, P>> {
+     private:
+        using working_type = std::conditional_t<
+            std::is_same_v<typename operators::traits::category_of<op>::type, operators::category::accumulation>, A, E
+        >;
+        using base = typename with_policy<op, P>::type;
+
+     public:
+        using type = std::conditional_t<
+            std::is_void_v<working_type>, base, working_precision_operator<base, working_type>
+        >;
+    };
+
+    // the operator with which to evaluate operations with the given bindings, which may carry a policy
+    template<typename op, typename B>
+    struct evaluation_operator : std::type_identity<op> {};
+    template<typename op, typename... V> requires(bindings<V...>::template has_bindings_for<policy_symbol>)
+    struct evaluation_operator<op, bindings<V...>> : with_evaluation_policy<
+        op, std::remove_cvref_t<decltype(std::declval<const bindings<V...>&>()[policy_symbol{}])>
+    > {};
+
+    template<typename op, typename B>
+    using evaluation_operator_t = typename evaluation_operator<op, B>::type;
+
+    template<typename... L>
+    struct concatenated;
+    template<>
+    struct concatenated<> : std::type_identity<type_list<>> {};
+    template<typename L0, typename... L>
+    struct concatenated<L0, L...> : std::type_identity<merged_t<L0, typename concatenated<L...>::type>> {};
+
+    template<typename T>
+    struct has_tensorial_node;
+    template<typename... N>
+    struct has_tensorial_node<type_list<N...>> : std::disjunction<is_complete<shape_of<N>>...> {};
+
+    // operands of nested applications of the same associative operator, e.g. (a*b)*c -> [a, b, c]
+    template<typename op, typename T>
+    struct operand_chain : std::type_identity<type_list<T>> {};
+    template<typename op, typename... Ts> requires(operators::is_associative_v<op>)
+    struct operand_chain<op, operation<op, Ts...>> : concatenated<typename operand_chain<op, Ts>::type...> {};
+
+    // chains of products/sums with tensorial nodes are not flattened, as e.g. (u*v)*w != u*(v*w) for vectors
+    template<typename op, typename... Ts>
+    inline constexpr bool is_flattenable = operators::is_associative_v<op>
+        and !has_tensorial_node<traits::nodes_of_t<operation<op, Ts...>>>::value;
+
+    template<typename T>
+    struct operands_of;
+    template<typename op, typename... Ts>
+    struct operands_of<operation<op, Ts...>> : std::conditional_t<
+        is_flattenable<op, Ts...>,
+        operand_chain<op, operation<op, Ts...>>,
+        std::type_identity<type_list<Ts...>>
+    > {};
+
+    template<typename L, bool node_found>
+    struct node_search_result : std::type_identity<L> {
+        static constexpr bool found = node_found;
+    };
+
+    template<typename T, typename visited, typename remaining>
+    struct without_first_equal_node;
+    template<typename T, typename... V>
+    struct without_first_equal_node<T, type_list<V...>, type_list<>>
+    : node_search_result<type_list<V...>, false> {};
+    template<typename T, typename... V, typename R0, typename... R>
+    struct without_first_equal_node<T, type_list<V...>, type_list<R0, R...>> : std::conditional_t<
+        traits::is_equal_node_v<T, R0>,
+        node_search_result<type_list<V..., R...>, true>,
+        without_first_equal_node<T, type_list<V..., R0>, type_list<R...>>
+    > {};
+
+    template<typename A, typename B>
+    struct is_node_permutation;
+    template<typename... B>
+    struct is_node_permutation<type_list<>, type_list<B...>> : std::bool_constant<sizeof...(B) == 0> {};
+    template<typename A0, typename... A, typename... B>
+    struct is_node_permutation<type_list<A0, A...>, type_list<B...>> {
+     private:
+        using remaining = without_first_equal_node<A0, type_list<>, type_list<B...>>;
+
+     public:
+        static constexpr bool value = std::conjunction_v<
+            std::bool_constant<sizeof...(A) + 1 == sizeof...(B) and remaining::found>,
+            is_node_permutation<type_list<A...>, typename remaining::type>
+        >;
+    };
+
+    template<typename A, typename B>
+    struct is_equal_operation : std::false_type {};
+    template<typename op, typename... A, typename... B>
+        requires(operators::is_commutative_v<op>)
+    struct is_equal_operation<operation<op, A...>, operation<op, B...>> : is_node_permutation<
+        typename operands_of<operation<op, A...>>::type,
+        typename operands_of<operation<op, B...>>::type
+    > {};
+    template<typename op, typename... A, typename... B>
+        requires(!operators::is_commutative_v<op> and sizeof...(A) == sizeof...(B))
+    struct is_equal_operation<operation<op, A...>, operation<op, B...>>
+    : std::conjunction<traits::is_equal_node<A, B>...> {};
+
+}  // namespace detail
+#endif  // DOXYGEN
+
+
 namespace traits {
 
-template<typename op, typename T1, typename T2>
-    requires(operators::is_commutative_v<op>)
-struct is_equal_node<operation<op, T1, T2>, operation<op, T2, T1>> : std::true_type {};
+//! Operations are equal if their operands are, taking into account commutativity and associativity
+template<typename op, typename... A, typename... B>
+struct is_equal_node<operation<op, A...>, operation<op, B...>> : std::disjunction<
+    std::is_same<operation<op, A...>, operation<op, B...>>,
+    xp::detail::is_equal_operation<operation<op, A...>, operation<op, B...>>
+> {};
 
 template<typename op, typename T, typename... Ts>
 struct nodes_of<operation<op, T, Ts...>> {
@@ -82,7 +280,10 @@ struct value_of<operation<op, Ts...>> {
         if constexpr (bindings<V...>::template has_bindings_for<self>)
             return binders[self{}];
         else
-            return op{}(xp::value_of(Ts{}, binders)...);
+            return xp::detail::instrumented_evaluation<self>(binders, [&] () -> decltype(auto) {
+                using evaluated_op = xp::detail::evaluation_operator_t<op, bindings<V...>>;
+                return evaluated_op{}(xp::value_of(Ts{}, binders)...);
+            });
     }
 };
 
@@ -0,0 +1,138 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Operators
+ * \brief Defines comparison operations on expressions.
+ */
+#pragma once
+
+#include <functional>
+#include <string_view>
+
+#include "../values.hpp"
+#include "../expressions.hpp"
+#include "common.hpp"
+
+
+namespace xp {
+
+//! \addtogroup Operators
+//! \{
+
+namespace operators {
+
+namespace traits {
+template<typename A, typename B> struct less_than;
+template<typename A, typename B> struct less_equal_than;
+template<typename A, typename B> struct greater_than;
+template<typename A, typename B> struct greater_equal_than;
+}  // namespace traits
+
+struct less : operator_base<traits::less_than, std::less<void>> {};
+struct less_equal : operator_base<traits::less_equal_than, std::less_equal<void>> {};
+struct greater : operator_base<traits::greater_than, std::greater<void>> {};
+struct greater_equal : operator_base<traits::greater_equal_than, std::greater_equal<void>> {};
+
+}  // namespace operators
+
+#ifndef DOXYGEN
+namespace detail {
+
+    template<typename op, typename A, typename B>
+    inline constexpr auto comparison_of(const A&, const B&) noexcept {
+        if constexpr (traits::is_constant_value_v<A> and traits::is_constant_value_v<B>)
+            return val<op{}(traits::value_of<A>::from(bindings<>{}), traits::value_of<B>::from(bindings<>{}))>;
+        else
+            return operation<op, A, B>{};
+    }
+
+    template<typename A, typename B, typename... V>
+    inline constexpr void write_comparison_to(std::ostream& out,
+                                              std::string_view symbol,
+                                              const bindings<V...>& values) noexcept {
+        static constexpr bool has_subterms_1 = traits::nodes_of_t<A>::size > 1;
+        if constexpr (has_subterms_1) out << "(";
+        write_to(out, A{}, values);
+        if constexpr (has_subterms_1) out << ")";
+
+        out << " " << symbol << " ";
+
+        static constexpr bool has_subterms_2 = traits::nodes_of_t<B>::size > 1;
+        if constexpr (has_subterms_2) out << "(";
+        write_to(out, B{}, values);
+        if constexpr (has_subterms_2) out << ")";
+    }
+
+}  // namespace detail
+#endif  // DOXYGEN
+
+template<expression A, expression B>
+inline constexpr auto operator<(const A& a, const B& b) noexcept {
+    return detail::comparison_of<operators::less>(a, b);
+}
+
+template<expression A, expression B>
+inline constexpr auto operator<=(const A& a, const B& b) noexcept {
+    return detail::comparison_of<operators::less_equal>(a, b);
+}
+
+template<expression A, expression B>
+inline constexpr auto operator>(const A& a, const B& b) noexcept {
+    return detail::comparison_of<operators::greater>(a, b);
+}
+
+template<expression A, expression B>
+inline constexpr auto operator>=(const A& a, const B& b) noexcept {
+    return detail::comparison_of<operators::greater_equal>(a, b);
+}
+
+namespace traits {
+
+//! Comparisons are piecewise constant, so their derivatives vanish (almost everywhere)
+template<typename op, typename T1, typename T2>
+    requires(is_any_of_v<op, operators::less, operators::less_equal, operators::greater, operators::greater_equal>)
+struct derivative_of<operation<op, T1, T2>> {
+    template<typename V>
+    static constexpr auto wrt(const type_list<V>&) noexcept {
+        return val<0>;
+    }
+};
+
+template<typename T1, typename T2>
+struct stream<operation<operators::less, T1, T2>> {
+    template<typename... V>
+    static constexpr void to(std::ostream& out, const bindings<V...>& values) noexcept {
+        xp::detail::write_comparison_to<T1, T2>(out, "<", values);
+    }
+};
+
+template<typename T1, typename T2>
+struct stream<operation<operators::less_equal, T1, T2>> {
+    template<typename... V>
+    static constexpr void to(std::ostream& out, const bindings<V...>& values) noexcept {
+        xp::detail::write_comparison_to<T1, T2>(out, "<=", values);
+    }
+};
+
+template<typename T1, typename T2>
+struct stream<operation<operators::greater, T1, T2>> {
+    template<typename... V>
+    static constexpr void to(std::ostream& out, const bindings<V...>& values) noexcept {
+        xp::detail::write_comparison_to<T1, T2>(out, ">", values);
+    }
+};
+
+template<typename T1, typename T2>
+struct stream<operation<operators::greater_equal, T1, T2>> {
+    template<typename... V>
+    static constexpr void to(std::ostream& out, const bindings<V...>& values) noexcept {
+        xp::detail::write_comparison_to<T1, T2>(out, ">=", values);
+    }
+};
+
+}  // namespace traits
+
+//! \} group Operators
+
+}  // namespace xp
@@ -0,0 +1,453 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Operators
+ * \brief Defines einsum-style contractions of tensorial expressions, e.g. `contract<"ijkl,kl->ij">(C, E)`.
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <algorithm>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "../values.hpp"
+#include "../expressions.hpp"
+#include "../linalg.hpp"
+#include "common.hpp"
+
+
+namespace xp {
+
+//! \addtogroup Operators
+//! \{
+
+namespace operators {
+
+/*!
+ * \brief Compile-time string describing a contraction in einsum notation, e.g. "ij,jk->ik".
+ * \details Each operand is described by one letter per dimension. Letters that do not appear on the right-hand
+ *          side of the arrow are summed over, and the right-hand side defines the index order of the result.
+ *          An empty right-hand side (e.g. "ij,ij->") yields a scalar.
+ */
+template<std::size_t N>
+struct contraction_spec {
+    char chars[N];
+
+    constexpr contraction_spec(const char (&s)[N]) noexcept { std::copy_n(s, N, chars); }
+
+    //! Return the full specification string
+    constexpr std::string_view str() const noexcept { return {chars, N - 1}; }
+
+    //! Return the labels of the first (0) or second (1) operand
+    constexpr std::string_view operand(std::size_t i) const noexcept {
+        const auto lhs = str().substr(0, str().find("->"));
+        const auto comma = lhs.find(',');
+        return i == 0 ? lhs.substr(0, comma) : lhs.substr(std::min(comma + 1, lhs.size()));
+    }
+
+    //! Return the labels of the result
+    constexpr std::string_view result() const noexcept {
+        const auto arrow = str().find("->");
+        return arrow == std::string_view::npos ? std::string_view{} : str().substr(arrow + 2);
+    }
+
+    //! Return true if this is a syntactically valid specification of a contraction of two operands
+    constexpr bool is_well_formed() const noexcept {
+        const auto arrow = str().find("->");
+        if (arrow == std::string_view::npos || str().find("->", arrow + 1) != std::string_view::npos)
+            return false;
+        if (std::ranges::count(str(), ',') != 1 || str().find(',') > arrow)
+            return false;
+        const auto is_label = [] (char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'); };
+        return std::ranges::all_of(operand(0), is_label)
+            && std::ranges::all_of(operand(1), is_label)
+            && std::ranges::all_of(result(), is_label);
+    }
+};
+
+}  // namespace operators
+
+#ifndef DOXYGEN
+namespace detail {
+
+    template<std::size_t... s>
+    constexpr std::array<std::size_t, sizeof...(s)> extents_of(const md_shape<s...>&) noexcept { return {s...}; }
+
+    // row-major strides of the dimensions of a tensor with the given extents
+    template<std::size_t n>
+    constexpr std::array<std::size_t, n> strides_of(const std::array<std::size_t, n>& extents) noexcept {
+        std::array<std::size_t, n> strides{};
+        std::size_t stride = 1;
+        for (std::size_t i = n; i > 0; --i) {
+            strides[i-1] = stride;
+            stride *= extents[i-1];
+        }
+        return strides;
+    }
+
+    /*!
+     * \brief Compile-time plan for evaluating the contraction `spec` of tensors with shapes `shape1` and `shape2`.
+     * \details The loop nest runs over the result indices (outermost, in result order) and the summed indices.
+     *          The summed indices are ordered by their combined stride in the operands, such that the innermost
+     *          loop walks through memory contiguously where possible. `for_each_term` runs this loop nest and
+     *          accumulates the offsets into the flattened result and operands per loop level. For operands with
+     *          structural zeros, the nest can also be tabulated into `terms` (with `term_count` entries, i.e. the
+     *          product of all index extents) such that terms involving zeros can be pruned at compile time.
+     */
+    template<auto spec, typename shape1, typename shape2>
+    struct contraction_plan {
+        static constexpr std::string_view first = spec.operand(0);
+        static constexpr std::string_view second = spec.operand(1);
+        static constexpr std::string_view result = spec.result();
+        static constexpr auto extents1 = extents_of(shape1{});
+        static constexpr auto extents2 = extents_of(shape2{});
+
+     private:
+        static constexpr bool _is_consistent() noexcept {
+            if (first.size() != extents1.size() || second.size() != extents2.size())
+                return false;
+            for (std::size_t i = 0; i < result.size(); ++i)
+                if (result.find(result[i], i + 1) != std::string_view::npos)
+                    return false;
+            for (char c : result)
+                if (first.find(c) == std::string_view::npos && second.find(c) == std::string_view::npos)
+                    return false;
+            for (std::size_t i = 0; i < first.size(); ++i)
+                if (_extent_of(first[i]) != extents1[i])
+                    return false;
+            for (std::size_t i = 0; i < second.size(); ++i)
+                if (_extent_of(second[i]) != extents2[i])
+                    return false;
+            return true;
+        }
+
+        static constexpr std::size_t _extent_of(char label) noexcept {
+            if (const auto pos = first.find(label); pos != std::string_view::npos && pos < extents1.size())
+                return extents1[pos];
+            if (const auto pos = second.find(label); pos != std::string_view::npos && pos < extents2.size())
+                return extents2[pos];
+            return 0;
+        }
+
+        template<std::size_t n>
+        static constexpr std::size_t _stride_of(char label,
+                                                std::string_view labels,
+                                                const std::array<std::size_t, n>& extents) noexcept {
+            const auto strides = strides_of(extents);
+            std::size_t stride = 0;
+            for (std::size_t i = 0; i < labels.size(); ++i)
+                if (labels[i] == label)
+                    stride += strides[i];
+            return stride;
+        }
+
+        static constexpr std::size_t _summed_count() noexcept {
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < first.size(); ++i)
+                if (first.substr(0, i).find(first[i]) == std::string_view::npos
+                        && result.find(first[i]) == std::string_view::npos)
+                    ++count;
+            for (std::size_t i = 0; i < second.size(); ++i)
+                if (second.substr(0, i).find(second[i]) == std::string_view::npos
+                        && first.find(second[i]) == std::string_view::npos
+                        && result.find(second[i]) == std::string_view::npos)
+                    ++count;
+            return count;
+        }
+
+     public:
+        static constexpr bool is_consistent = _is_consistent();
+        static constexpr std::size_t summed_dimensions = _summed_count();
+        static constexpr std::size_t loop_dimensions = result.size() + summed_dimensions;
+
+        //! labels of the loop nest, from the outermost to the innermost loop
+        static constexpr std::array<char, loop_dimensions> loop_labels = [] () {
+            std::array<char, loop_dimensions> labels{};
+            std::ranges::copy(result, labels.begin());
+            std::size_t n = result.size();
+            for (std::string_view operand : {first, second})
+                for (char c : operand)
+                    if (std::find(labels.begin(), labels.begin() + n, c) == labels.begin() + n)
+                        labels[n++] = c;
+            // larger strides outermost, keeping the order of appearance for equal strides (insertion sort)
+            const auto stride = [] (char c) {
+                return _stride_of(c, first, extents1) + _stride_of(c, second, extents2);
+            };
+            for (std::size_t i = result.size() + 1; i < loop_dimensions; ++i)
+                for (std::size_t j = i; j > result.size() && stride(labels[j-1]) < stride(labels[j]); --j)
+                    std::swap(labels[j-1], labels[j]);
+            return labels;
+        } ();
+
+        static constexpr auto result_extents = [] () {
+            std::array<std::size_t, result.size()> extents{};
+            std::ranges::transform(result, extents.begin(), _extent_of);
+            return extents;
+        } ();
+
+        static constexpr std::size_t result_count = [] () {
+            std::size_t count = 1;
+            for (auto e : result_extents) count *= e;
+            return count;
+        } ();
+
+        static constexpr std::array<std::size_t, loop_dimensions> loop_extents = [] () {
+            std::array<std::size_t, loop_dimensions> extents{};
+            std::ranges::transform(loop_labels, extents.begin(), _extent_of);
+            return extents;
+        } ();
+
+        //! strides of the loop indices in the flattened result and operands
+        static constexpr auto result_strides = [] () {
+            std::array<std::size_t, loop_dimensions> strides{};
+            std::ranges::transform(loop_labels, strides.begin(), [] (char c) {
+                return _stride_of(c, result, result_extents);
+            });
+            return strides;
+        } ();
+        static constexpr auto first_strides = [] () {
+            std::array<std::size_t, loop_dimensions> strides{};
+            std::ranges::transform(loop_labels, strides.begin(), [] (char c) {
+                return _stride_of(c, first, extents1);
+            });
+            return strides;
+        } ();
+        static constexpr auto second_strides = [] () {
+            std::array<std::size_t, loop_dimensions> strides{};
+            std::ranges::transform(loop_labels, strides.begin(), [] (char c) {
+                return _stride_of(c, second, extents2);
+            });
+            return strides;
+        } ();
+
+        static constexpr std::size_t term_count = [] () {
+            std::size_t count = 1;
+            for (char c : loop_labels) count *= _extent_of(c);
+            return count;
+        } ();
+
+        using result_shape = decltype([] <std::size_t... i> (std::index_sequence<i...>) {
+            return md_shape<result_extents[i]...>{};
+        } (std::make_index_sequence<result_extents.size()>{}));
+
+        struct term { std::size_t result; std::size_t first; std::size_t second; };
+
+        //! Invoke `f(result_offset, first_offset, second_offset)` for each iteration of the loop nest
+        template<std::size_t level = 0, typename F>
+        static constexpr void for_each_term(const F& f,
+                                            std::size_t r = 0,
+                                            std::size_t a = 0,
+                                            std::size_t b = 0) noexcept {
+            if constexpr (level == loop_dimensions)
+                f(r, a, b);
+            else
+                for (std::size_t i = 0; i < loop_extents[level]; ++i)
+                    for_each_term<level + 1>(
+                        f, r + i*result_strides[level], a + i*first_strides[level], b + i*second_strides[level]
+                    );
+        }
+
+        //! the tabulated loop nest
+        static constexpr std::array<term, term_count> terms = [] () {
+            std::array<term, term_count> terms{};
+            std::size_t k = 0;
+            for_each_term([&] (std::size_t r, std::size_t a, std::size_t b) { terms[k++] = {r, a, b}; });
+            return terms;
+        } ();
+    };
+
+    //! Maximum number of terms of a contraction plan that are tabulated in order to prune structural zeros
+    inline constexpr std::size_t max_pruned_contraction_terms = 4096;
+
+    //! The terms of a contraction plan that do not involve structural zeros of the operands
+    template<typename plan, auto zeros1, auto zeros2>
+    struct pruned_contraction_terms {
+        static constexpr auto is_pruned = [] (const typename plan::term& t) {
+            return zeros1[t.first] || zeros2[t.second];
+        };
+
+        static constexpr std::size_t count = plan::term_count - std::ranges::count_if(plan::terms, is_pruned);
+
+        static constexpr std::array<typename plan::term, count> terms = [] () {
+            std::array<typename plan::term, count> terms{};
+            std::ranges::remove_copy_if(plan::terms, terms.begin(), is_pruned);
+            return terms;
+        } ();
+
+        //! mask of the result entries to which no term contributes
+        static constexpr std::array<bool, plan::result_count> result_zeros = [] () {
+            std::array<bool, plan::result_count> zeros;
+            zeros.fill(true);
+            for (const auto& t : terms)
+                zeros[t.result] = false;
+            return zeros;
+        } ();
+    };
+
+    template<tensorial T>
+    constexpr auto flattened(const T& t) noexcept {
+        using shape = shape_of_t<T>;
+        std::array<scalar_type_t<T>, shape::count> result{};
+        visit_indices_in(shape{}, [&] (const auto& idx) {
+            result[idx.as_flat_index_in(shape{}).value] = access<T>::at(idx, t);
+        });
+        return result;
+    }
+
+}  // namespace detail
+#endif  // DOXYGEN
+
+namespace operators {
+
+namespace traits { template<auto spec, typename A, typename B> struct contraction_of; }
+
+/*!
+ * \brief Evaluates contractions in the loop nest of the contraction plan.
+ * \details If any of the operands has structural zeros, and the loop nest has at most
+ *          `detail::max_pruned_contraction_terms` iterations, the loop nest is tabulated at compile time and
+ *          the terms involving zeros are pruned. The result then carries the structural zeros that follow from it.
+ */
+template<auto spec>
+struct default_contraction_operator {
+    template<tensorial T1, tensorial T2>
+    constexpr auto operator()(const T1& t1, const T2& t2) const noexcept {
+        using plan = xp::detail::contraction_plan<spec, shape_of_t<T1>, shape_of_t<T2>>;
+        using scalar = std::common_type_t<scalar_type_t<T1>, scalar_type_t<T2>>;
+        static_assert(plan::is_consistent, "Contraction specification does not match the operand shapes.");
+        constexpr bool is_pruned = plan::term_count <= xp::detail::max_pruned_contraction_terms && (
+            std::ranges::any_of(linalg::structural_zeros_v<T1>, std::identity{})
+            || std::ranges::any_of(linalg::structural_zeros_v<T2>, std::identity{})
+        );
+
+        const auto a = xp::detail::flattened(t1);
+        const auto b = xp::detail::flattened(t2);
+        std::array<scalar, plan::result_count> result;
+        result.fill(scalar{0});
+        if constexpr (is_pruned) {
+            using pruned = xp::detail::pruned_contraction_terms<
+                plan, linalg::structural_zeros_v<T1>, linalg::structural_zeros_v<T2>
+            >;
+            for (const auto& term : pruned::terms)
+                result[term.result] += a[term.first]*b[term.second];
+            return _make_result<plan, pruned::result_zeros>(std::move(result));
+        } else {
+            plan::for_each_term([&] (std::size_t r, std::size_t i, std::size_t j) { result[r] += a[i]*b[j]; });
+            return _make_result<plan, std::array<bool, plan::result_count>{}>(std::move(result));
+        }
+    }
+
+ private:
+    template<typename plan, auto zeros, typename scalar>
+    static constexpr auto _make_result(std::array<scalar, plan::result_count>&& values) noexcept {
+        using result_shape = typename plan::result_shape;
+        if constexpr (result_shape::dimensions == 0)
+            return values[0];
+        else
+            return linalg::masked_tensor_t<scalar, result_shape, zeros>{result_shape{}, std::move(values)};
+    }
+};
+
+template<auto spec>
+struct contraction {
+    static constexpr auto specification = spec;
+
+    template<typename... T>
+    constexpr decltype(auto) operator()(T&&... t) const noexcept {
+        using specialization = traits::contraction_of<spec, std::remove_cvref_t<T>...>;
+        if constexpr (is_complete_v<specialization>)
+            return specialization{}(std::forward<T>(t)...);
+        else
+            return default_contraction_operator<spec>{}(std::forward<T>(t)...);
+    }
+};
+
+namespace traits {
+
+//! Specialization for double contractions of symmetric tensors, which visit each off-diagonal pair only once
+template<auto spec, typename T1, typename T2, std::size_t n>
+    requires(spec.result().empty()
+             and spec.operand(0).size() == 2 and spec.operand(1).size() == 2
+             and spec.operand(0)[0] != spec.operand(0)[1]
+             and spec.operand(1).find(spec.operand(0)[0]) != std::string_view::npos
+             and spec.operand(1).find(spec.operand(0)[1]) != std::string_view::npos)
+struct contraction_of<spec, linalg::symmetric_tensor<T1, n>, linalg::symmetric_tensor<T2, n>> {
+    constexpr auto operator()(const linalg::symmetric_tensor<T1, n>& A,
+                              const linalg::symmetric_tensor<T2, n>& B) const noexcept {
+        return linalg::double_contraction_of(A, B);
+    }
+};
+
+template<auto spec> struct cost<contraction<spec>> : std::integral_constant<std::size_t, 10> {};
+template<auto spec> struct category_of<contraction<spec>> : std::type_identity<category::accumulation> {};
+}  // namespace traits
+
+}  // namespace operators
+
+/*!
+ * \brief Contract two tensorial expressions as described by the given specification in einsum notation.
+ * \details For instance, `contract<"ij,jk->ik">(A, B)` is the matrix product, `contract<"ij,ij->">(A, B)`
+ *          the double contraction `A:B` and `contract<"ijkl,kl->ij">(C, E)` applies a 4th-order tensor to a
+ *          2nd-order tensor.
+ */
+template<operators::contraction_spec spec, tensor_valued_expression T1, tensor_valued_expression T2>
+inline constexpr auto contract(const T1&, const T2&) noexcept {
+    static_assert(spec.is_well_formed(), "Contraction specification must have the form 'ab..,cd..->ef..'.");
+    static_assert(
+        detail::contraction_plan<spec, shape_of_t<T1>, shape_of_t<T2>>::is_consistent,
+        "Contraction specification does not match the operand shapes."
+    );
+    return operation<operators::contraction<spec>, T1, T2>{};
+}
+
+//! Contractions with a non-empty result are tensor-valued
+template<auto spec, tensor_valued_expression T1, tensor_valued_expression T2>
+    requires(!spec.result().empty())
+struct shape_of<operation<operators::contraction<spec>, T1, T2>> {
+    using type = typename detail::contraction_plan<spec, shape_of_t<T1>, shape_of_t<T2>>::result_shape;
+};
+
+namespace traits {
+
+template<auto spec, tensor_valued_expression T1, tensor_valued_expression T2>
+struct derivative_of<operation<operators::contraction<spec>, T1, T2>> {
+    template<typename V>
+    static constexpr decltype(auto) wrt(const type_list<V>& var) {
+        return _contract(xp::detail::differentiate<T1>(var), T2{})
+            + _contract(T1{}, xp::detail::differentiate<T2>(var));
+    }
+
+ private:
+    template<tensor_valued_expression _T1, tensor_valued_expression _T2>
+    static constexpr decltype(auto) _contract(const _T1& t1, const _T2& t2) noexcept {
+        return contract<spec>(t1, t2);
+    }
+
+    template<expression _T1, expression _T2>
+        requires(!tensor_valued_expression<_T1> or !tensor_valued_expression<_T2>)
+    static constexpr decltype(auto) _contract(const _T1& t1, const _T2& t2) noexcept {
+        return t1*t2;
+    }
+};
+
+template<auto spec, typename T1, typename T2>
+struct stream<operation<operators::contraction<spec>, T1, T2>> {
+    template<typename... V>
+    static constexpr void to(std::ostream& out, const bindings<V...>& values) noexcept {
+        out << "contract<" << spec.str() << ">(";
+        write_to(out, T1{}, values);
+        out << ", ";
+        write_to(out, T2{}, values);
+        out << ")";
+    }
+};
+
+}  // namespace traits
+
+//! \} group Operators
+
+}  // namespace xp
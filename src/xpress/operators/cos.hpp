@@ -0,0 +1,96 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Operators
+ * \brief Defines cosine operations on expressions.
+ */
+#pragma once
+
+#include <cmath>
+
+#include "../values.hpp"
+#include "../expressions.hpp"
+#include "../linalg.hpp"
+#include "../fast_math.hpp"
+#include "common.hpp"
+
+
+namespace xp {
+
+//! \addtogroup Operators
+//! \{
+
+namespace operators {
+
+namespace traits { template<typename A> struct cos_of; }
+
+template<typename P>
+struct default_cos_operator {
+    template<typename A>
+    constexpr auto operator()(A&& a) const noexcept {
+        if constexpr (std::is_same_v<P, policy::fast> and std::is_arithmetic_v<std::remove_cvref_t<A>>)
+            return fast_math::cos(a);
+        else
+            return std::cos(std::forward<A>(a));
+    }
+};
+
+struct cos : policy_operator_base<traits::cos_of, default_cos_operator> {};
+
+namespace traits {
+
+template<> struct cost<cos> : std::integral_constant<std::size_t, 20> {};
+
+//! (Default) specialization for tensors
+template<xp::tensorial T>
+struct cos_of<T> {
+    template<typename P = policy::precise, same_remove_cvref_t_as<T> _T>
+    constexpr auto operator()(_T&& t) const noexcept {
+        using scalar = scalar_type_t<T>;
+        using shape = shape_of_t<T>;
+        linalg::tensor<scalar, shape> result{};
+        visit_indices_in(shape{}, [&] (const auto& idx) {
+            result[idx] = operators::cos::with_policy<P>{}(access<T>::at(idx, t));
+        });
+        return result;
+    }
+};
+
+}  // namespace traits
+
+}  // namespace operators
+
+template<expression A>
+inline constexpr auto cos(const A&) noexcept {
+    if constexpr (traits::is_zero_value_v<A>)
+        return val<1>;
+    else
+        return operation<operators::cos, A>{};
+}
+
+namespace traits {
+
+template<typename T>
+struct derivative_of<operation<operators::cos, T>> {
+    template<typename V>
+    static constexpr auto wrt(const type_list<V>& var) noexcept {
+        return -sin(T{})*xp::detail::differentiate<T>(var);
+    }
+};
+
+template<typename T>
+struct stream<operation<operators::cos, T>> {
+    template<typename... V>
+    static constexpr void to(std::ostream& out, const bindings<V...>& values) noexcept {
+        out << "cos(";
+        write_to(out, T{}, values);
+        out << ")";
+    }
+};
+
+}  // namespace traits
+
+//! \} group Operators
+
+}  // namespace xp
@@ -34,6 +34,11 @@ struct default_determinant_operator {
 
 struct determinant : operator_base<traits::determinant_of, default_determinant_operator> {};
 
+namespace traits {
+template<> struct cost<determinant> : std::integral_constant<std::size_t, 10> {};
+template<> struct category_of<determinant> : std::type_identity<category::accumulation> {};
+}  // namespace traits
+
 }  // namespace operators
 
 template<tensorial_expression T>
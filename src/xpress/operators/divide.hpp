@@ -7,7 +7,9 @@
  */
 #pragma once
 
+#include <concepts>
 #include <functional>
+#include <type_traits>
 
 #include "../values.hpp"
 #include "../expressions.hpp"
@@ -22,6 +24,18 @@ namespace xp {
 
 namespace operators {
 
+#ifndef DOXYGEN
+namespace detail {
+
+    // arithmetic operands whose quotient is a floating-point number
+    template<typename A, typename B>
+    concept floating_point_quotient = std::is_arithmetic_v<A>
+        and std::is_arithmetic_v<B>
+        and std::floating_point<std::common_type_t<A, B>>;
+
+}  // namespace detail
+#endif  // DOXYGEN
+
 namespace traits {
 
 template<typename A, typename B>
@@ -30,20 +44,76 @@ struct division_of;
 //! (Default) specialization for tensors with scalars
 template<tensorial T, typename S> requires(is_scalar_v<S>)
 struct division_of<T, S> {
-    template<same_remove_cvref_t_as<T> _T, same_remove_cvref_t_as<S> _S>
+    template<typename P = policy::precise, same_remove_cvref_t_as<T> _T, same_remove_cvref_t_as<S> _S>
     constexpr T operator()(_T&& tensor, _S&& scalar) const noexcept {
         T result;
-        visit_indices_in(shape_of_t<T>{}, [&] (const auto& idx) {
-            scalar_type_t<T>& value_at_idx = access<T>::at(idx, result);
-            value_at_idx = access<T>::at(idx, tensor)/scalar;
-        });
+        if constexpr (std::is_same_v<P, policy::fast>
+                      and detail::floating_point_quotient<scalar_type_t<T>, std::remove_cvref_t<S>>) {
+            using value_type = std::common_type_t<scalar_type_t<T>, std::remove_cvref_t<S>>;
+            const value_type reciprocal = value_type{1}/scalar;
+            visit_indices_in(shape_of_t<T>{}, [&] (const auto& idx) {
+                scalar_type_t<T>& value_at_idx = access<T>::at(idx, result);
+                value_at_idx = access<T>::at(idx, tensor)*reciprocal;
+            });
+        } else {
+            visit_indices_in(shape_of_t<T>{}, [&] (const auto& idx) {
+                scalar_type_t<T>& value_at_idx = access<T>::at(idx, result);
+                value_at_idx = access<T>::at(idx, tensor)/scalar;
+            });
+        }
         return result;
     }
 };
 
+//! Specialization for structured tensors with scalars, which preserves their structural zeros
+template<typename T, typename shape, typename... E, typename S> requires(is_scalar_v<S>)
+struct division_of<linalg::structured_tensor<T, shape, type_list<E...>>, S> {
+    using tensor_type = linalg::structured_tensor<T, shape, type_list<E...>>;
+    using scalar = std::common_type_t<T, S>;
+    using result = linalg::structured_tensor<
+        scalar, shape, type_list<std::conditional_t<xp::traits::is_zero_value_v<E>, E, linalg::stored_entry>...>
+    >;
+
+    template<typename P = policy::precise>
+    constexpr auto operator()(const tensor_type& tensor, const S& s) const noexcept {
+        constexpr bool use_reciprocal = std::is_same_v<P, policy::fast> and detail::floating_point_quotient<T, S>;
+        const scalar factor = use_reciprocal ? scalar{1}/s : scalar{1};
+        std::array<scalar, shape::count> values{};
+        visit_indices_in(shape{}, [&] <std::size_t... i> (const md_index<i...>& idx) {
+            constexpr std::size_t flat = md_index<i...>::as_flat_index_in(shape{}).value;
+            if constexpr (result::is_stored[flat] and use_reciprocal)
+                values[flat] = tensor[idx]*factor;
+            else if constexpr (result::is_stored[flat])
+                values[flat] = tensor[idx]/s;
+        });
+        return result{shape{}, values};
+    }
+};
+
 }  // namespace traits
 
-struct divide : operator_base<traits::division_of, std::divides<void>> {};
+/*!
+ * \brief Divides two values.
+ * \note With policy::fast, floating-point divisions are carried out as multiplications with the reciprocal,
+ *       which adds an error of up to 1 ULP. For divisions of tensors by scalars, the reciprocal is computed once.
+ */
+template<typename P>
+struct default_divide_operator {
+    template<typename A, typename B>
+    constexpr auto operator()(A&& a, B&& b) const noexcept {
+        if constexpr (std::is_same_v<P, policy::fast>
+                      and detail::floating_point_quotient<std::remove_cvref_t<A>, std::remove_cvref_t<B>>)
+            return a*(std::common_type_t<std::remove_cvref_t<A>, std::remove_cvref_t<B>>{1}/b);
+        else
+            return std::divides<void>{}(std::forward<A>(a), std::forward<B>(b));
+    }
+};
+
+struct divide : policy_operator_base<traits::division_of, default_divide_operator> {};
+
+namespace traits {
+template<> struct cost<divide> : std::integral_constant<std::size_t, 4> {};
+}  // namespace traits
 
 }  // namespace operators
 
@@ -55,7 +125,7 @@ inline constexpr auto operator/(const A&, const B&) noexcept {
         return val<0>;
     else if constexpr (traits::is_unit_value_v<B>)
         return A{};
-    else if constexpr (std::is_same_v<A, B>)
+    else if constexpr (traits::is_equal_node_v<A, B>)
         return val<1>;
     else
         return operation<operators::divide, A, B>{};
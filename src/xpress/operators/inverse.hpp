@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Operators
+ * \brief Defines the matrix inverse operator on tensorial expressions.
+ */
+#pragma once
+
+#include <type_traits>
+
+#include "../values.hpp"
+#include "../expressions.hpp"
+#include "../linalg.hpp"
+#include "common.hpp"
+#include "mat_mul.hpp"
+
+
+namespace xp {
+
+//! \addtogroup Operators
+//! \{
+
+namespace operators {
+
+namespace traits { template<typename T> struct inverse_of; }
+
+struct default_inverse_operator {
+    template<tensorial T>
+    constexpr auto operator()(T&& t) const noexcept {
+        return linalg::inverse_of(std::forward<T>(t));
+    }
+};
+
+struct inverse : operator_base<traits::inverse_of, default_inverse_operator> {};
+
+namespace traits {
+template<> struct cost<inverse> : std::integral_constant<std::size_t, 20> {};
+template<> struct category_of<inverse> : std::type_identity<category::accumulation> {};
+}  // namespace traits
+
+}  // namespace operators
+
+template<tensor_valued_expression T>
+inline constexpr auto inverse(const T&) noexcept {
+    static_assert(shape_of_t<T>{}.is_square, "Inverse can only be taken on square matrices.");
+    return operation<operators::inverse, T>{};
+}
+
+//! The inverse of an inverse is the original expression
+template<tensor_valued_expression T>
+inline constexpr auto inverse(const operation<operators::inverse, T>&) noexcept {
+    return T{};
+}
+
+template<tensor_valued_expression T>
+struct shape_of<operation<operators::inverse, T>> : shape_of<T> {};
+
+namespace traits {
+
+//! Derivative via d(A^-1) = -A^-1 dA A^-1
+template<tensor_valued_expression T>
+struct derivative_of<operation<operators::inverse, T>> {
+    template<typename V>
+    static constexpr decltype(auto) wrt(const type_list<V>& var) {
+        constexpr auto inv = operation<operators::inverse, T>{};
+        return -_mat_mul(_mat_mul(inv, xp::detail::differentiate<T>(var)), inv);
+    }
+
+ private:
+    template<expression _T1, expression _T2>
+    static constexpr decltype(auto) _mat_mul(const _T1& t1, const _T2& t2) noexcept {
+        if constexpr (tensor_valued_expression<_T1> and tensor_valued_expression<_T2>)
+            return mat_mul(t1, t2);
+        else
+            return t1*t2;
+    }
+};
+
+template<tensor_valued_expression T>
+struct stream<operation<operators::inverse, T>> {
+    template<typename... V>
+    static constexpr void to(std::ostream& out, const bindings<V...>& values) noexcept {
+        out << "inverse("; write_to(out, T{}, values); out << ")";
+    }
+};
+
+}  // namespace traits
+
+//! \} group Operators
+
+}  // namespace xp
@@ -12,6 +12,7 @@
 #include "../values.hpp"
 #include "../expressions.hpp"
 #include "../linalg.hpp"
+#include "../fast_math.hpp"
 #include "common.hpp"
 
 
@@ -24,27 +25,33 @@ namespace operators {
 
 namespace traits { template<typename A> struct log_of; }
 
+template<typename P>
 struct default_log_operator {
     template<typename A>
     constexpr auto operator()(A&& a) const noexcept {
-        return std::log(std::forward<A>(a));
+        if constexpr (std::is_same_v<P, policy::fast> and std::is_arithmetic_v<std::remove_cvref_t<A>>)
+            return fast_math::log(a);
+        else
+            return std::log(std::forward<A>(a));
     }
 };
 
-struct log : operator_base<traits::log_of, default_log_operator> {};
+struct log : policy_operator_base<traits::log_of, default_log_operator> {};
 
 namespace traits {
 
+template<> struct cost<log> : std::integral_constant<std::size_t, 15> {};
+
 //! (Default) specialization for tensors
 template<xp::tensorial T>
 struct log_of<T> {
-    template<same_remove_cvref_t_as<T> _T>
+    template<typename P = policy::precise, same_remove_cvref_t_as<T> _T>
     constexpr auto operator()(_T&& t) const noexcept {
         using scalar = scalar_type_t<T>;
         using shape = shape_of_t<T>;
         linalg::tensor<scalar, shape> result{};
         visit_indices_in(shape{}, [&] (const auto& idx) {
-            result[idx] = operators::log{}(access<T>::at(idx, t));
+            result[idx] = operators::log::with_policy<P>{}(access<T>::at(idx, t));
         });
         return result;
     }
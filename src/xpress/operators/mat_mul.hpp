@@ -33,16 +33,27 @@ struct default_mat_mul_operator {
 
 struct mat_mul : operator_base<traits::mat_mul_of, default_mat_mul_operator> {};
 
+namespace traits {
+template<> struct cost<mat_mul> : std::integral_constant<std::size_t, 10> {};
+template<> struct category_of<mat_mul> : std::type_identity<category::accumulation> {};
+}  // namespace traits
+
 }  // namespace operators
 
-template<tensorial_expression T1, tensorial_expression T2>
+template<tensor_valued_expression T1, tensor_valued_expression T2>
 inline constexpr auto mat_mul(const T1&, const T2&) noexcept {
     return operation<operators::mat_mul, T1, T2>{};
 }
 
+template<tensor_valued_expression T1, tensor_valued_expression T2>
+struct shape_of<operation<operators::mat_mul, T1, T2>> : std::type_identity<decltype(md_shape{
+    typename shape_of_t<T1>::as_values_t{}.template crop<1>()
+    + typename shape_of_t<T2>::as_values_t{}.template drop<1>()
+})> {};
+
 namespace traits {
 
-template<tensorial_expression T1, tensorial_expression T2>
+template<tensor_valued_expression T1, tensor_valued_expression T2>
 struct derivative_of<operation<operators::mat_mul, T1, T2>> {
     template<typename V>
     static constexpr decltype(auto) wrt(const type_list<V>& var) {
@@ -50,20 +61,20 @@ struct derivative_of<operation<operators::mat_mul, T1, T2>> {
     }
 
  private:
-    template<tensorial_expression _T1, tensorial_expression _T2>
+    template<tensor_valued_expression _T1, tensor_valued_expression _T2>
     static constexpr decltype(auto) _mat_mul(const _T1& t1, const _T2& t2) noexcept {
         return mat_mul(t1, t2);
     }
 
     template<expression _T1, expression _T2>
-        requires(!tensorial_expression<_T1> or !tensorial_expression<_T2>)
+        requires(!tensor_valued_expression<_T1> or !tensor_valued_expression<_T2>)
     static constexpr decltype(auto) _mat_mul(const _T1& t1, const _T2& t2) noexcept {
         return t1*t2;
     }
 };
 
 // stream it the same way as multiplication
-template<tensorial_expression T1, tensorial_expression T2>
+template<tensor_valued_expression T1, tensor_valued_expression T2>
 struct stream<operation<operators::mat_mul, T1, T2>>
 : stream<operation<operators::multiply, T1, T2>> {};
 
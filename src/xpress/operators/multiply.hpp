@@ -7,6 +7,7 @@
  */
 #pragma once
 
+#include <algorithm>
 #include <functional>
 
 #include "../values.hpp"
@@ -50,25 +51,86 @@ struct multiplication_of<S, T> {
     }
 };
 
-//! (Default) specialization for tensors with tensors
+//! (Default) specialization for tensors with tensors, skipping the terms with structural zeros
 template<tensorial T1, tensorial T2>
     requires(shape_of_t<T1>{} == shape_of_t<T2>{})
 struct multiplication_of<T1, T2> {
     template<same_remove_cvref_t_as<T1> _T1, same_remove_cvref_t_as<T2> _T2>
     constexpr auto operator()(_T1&& A, _T2&& B) const noexcept {
         scalar_type_t<T1> result{0};
-        visit_indices_in(shape_of_t<T1>{}, [&] (const auto& idx) {
-            result += access<T1>::at(idx, A)*access<T2>::at(idx, B);
+        visit_indices_in(shape_of_t<T1>{}, [&] <std::size_t... i> (const md_index<i...>& idx) {
+            if constexpr (!linalg::is_structural_zero_v<T1, md_index<i...>>
+                          and !linalg::is_structural_zero_v<T2, md_index<i...>>)
+                result += access<T1>::at(idx, A)*access<T2>::at(idx, B);
         });
         return result;
     }
 };
 
+//! Specialization for symmetric tensors with scalars, scaling only the independent entries
+template<typename T, std::size_t n, typename S> requires(is_scalar_v<S>)
+struct multiplication_of<linalg::symmetric_tensor<T, n>, S> {
+    constexpr auto operator()(const linalg::symmetric_tensor<T, n>& tensor, const S& scalar) const noexcept {
+        auto result = tensor;
+        std::ranges::for_each(result.voigt(), [&] (auto& v) { v *= scalar; });
+        return result;
+    }
+};
+
+//! Specialization for scalars with symmetric tensors
+template<typename S, typename T, std::size_t n> requires(is_scalar_v<S>)
+struct multiplication_of<S, linalg::symmetric_tensor<T, n>> {
+    constexpr auto operator()(const S& scalar, const linalg::symmetric_tensor<T, n>& tensor) const noexcept {
+        return multiplication_of<linalg::symmetric_tensor<T, n>, S>{}(tensor, scalar);
+    }
+};
+
+//! Specialization for symmetric tensors with symmetric tensors
+template<typename T1, typename T2, std::size_t n>
+struct multiplication_of<linalg::symmetric_tensor<T1, n>, linalg::symmetric_tensor<T2, n>> {
+    constexpr auto operator()(const linalg::symmetric_tensor<T1, n>& A,
+                              const linalg::symmetric_tensor<T2, n>& B) const noexcept {
+        return linalg::double_contraction_of(A, B);
+    }
+};
+
+//! Specialization for structured tensors with scalars, which preserves their structural zeros
+template<typename T, typename shape, typename... P, typename S> requires(is_scalar_v<S>)
+struct multiplication_of<linalg::structured_tensor<T, shape, type_list<P...>>, S> {
+    using tensor_type = linalg::structured_tensor<T, shape, type_list<P...>>;
+    using scalar = std::common_type_t<T, S>;
+    using result = linalg::structured_tensor<
+        scalar, shape, type_list<std::conditional_t<xp::traits::is_zero_value_v<P>, P, linalg::stored_entry>...>
+    >;
+
+    constexpr auto operator()(const tensor_type& tensor, const S& s) const noexcept {
+        std::array<scalar, shape::count> values{};
+        visit_indices_in(shape{}, [&] <std::size_t... i> (const md_index<i...>& idx) {
+            constexpr std::size_t flat = md_index<i...>::as_flat_index_in(shape{}).value;
+            if constexpr (result::is_stored[flat])
+                values[flat] = tensor[idx]*s;
+        });
+        return result{shape{}, values};
+    }
+};
+
+//! Specialization for scalars with structured tensors
+template<typename S, typename T, typename shape, typename pattern> requires(is_scalar_v<S>)
+struct multiplication_of<S, linalg::structured_tensor<T, shape, pattern>> {
+    constexpr auto operator()(const S& scalar,
+                              const linalg::structured_tensor<T, shape, pattern>& tensor) const noexcept {
+        return multiplication_of<linalg::structured_tensor<T, shape, pattern>, S>{}(tensor, scalar);
+    }
+};
+
 }  // namespace traits
 
 struct multiply : operator_base<traits::multiplication_of, std::multiplies<void>> {};
 
-namespace traits { template<> struct is_commutative<multiply> : std::true_type {}; }
+namespace traits {
+template<> struct is_commutative<multiply> : std::true_type {};
+template<> struct is_associative<multiply> : std::true_type {};
+}  // namespace traits
 
 }  // namespace operators
 
@@ -85,6 +147,10 @@ inline constexpr auto operator*(const A&, const B&) noexcept {
         return operation<operators::multiply, A, B>{};
 }
 
+//! Scaling a tensor-valued expression by a constant (e.g. when negating it) preserves its shape
+template<typename V, tensor_valued_expression T> requires(traits::is_constant_value_v<V>)
+struct shape_of<operation<operators::multiply, V, T>> : shape_of<T> {};
+
 namespace traits {
 
 template<typename T1, typename T2>
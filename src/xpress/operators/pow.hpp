@@ -12,6 +12,7 @@
 #include "../values.hpp"
 #include "../expressions.hpp"
 #include "../linalg.hpp"
+#include "../fast_math.hpp"
 #include "common.hpp"
 
 
@@ -24,27 +25,38 @@ namespace operators {
 
 namespace traits { template<typename A, typename B> struct power_of; }
 
+template<typename P>
 struct default_pow_operator {
     template<typename A, typename B>
     constexpr auto operator()(A&& a, B&& b) const noexcept {
-        return std::pow(std::forward<A>(a), std::forward<B>(b));
+        // integral exponents are left to std::pow, which handles them more efficiently and accurately
+        if constexpr (std::is_same_v<P, policy::fast>
+                      and std::is_arithmetic_v<std::remove_cvref_t<A>>
+                      and std::is_floating_point_v<std::remove_cvref_t<B>>) {
+            // the approximation e^(b*log(a)) only holds for positive bases
+            using result_t = decltype(fast_math::pow(a, b));
+            return a > 0 ? fast_math::pow(a, b) : static_cast<result_t>(std::pow(a, b));
+        } else
+            return std::pow(std::forward<A>(a), std::forward<B>(b));
     }
 };
 
-struct pow : operator_base<traits::power_of, default_pow_operator> {};
+struct pow : policy_operator_base<traits::power_of, default_pow_operator> {};
 
 namespace traits {
 
+template<> struct cost<pow> : std::integral_constant<std::size_t, 20> {};
+
 //! (Default) specialization for tensors
 template<tensorial T, typename E>
 struct power_of<T, E> {
-    template<same_remove_cvref_t_as<T> _T, same_remove_cvref_t_as<E> _E>
+    template<typename P = policy::precise, same_remove_cvref_t_as<T> _T, same_remove_cvref_t_as<E> _E>
     constexpr auto operator()(_T&& t, _E&& e) const noexcept {
         using scalar = scalar_type_t<T>;
         using shape = shape_of_t<T>;
         linalg::tensor<scalar, shape> result{};
         visit_indices_in(shape{}, [&] (const auto& idx) {
-            result[idx] = operators::pow{}(access<T>::at(idx, t), e);
+            result[idx] = operators::pow::with_policy<P>{}(access<T>::at(idx, t), e);
         });
         return result;
     }
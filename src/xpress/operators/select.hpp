@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Operators
+ * \brief Defines conditional (piecewise) expressions.
+ */
+#pragma once
+
+#include "../values.hpp"
+#include "../expressions.hpp"
+#include "common.hpp"
+#include "compare.hpp"
+#include "multiply.hpp"
+
+
+namespace xp {
+
+//! \addtogroup Operators
+//! \{
+
+namespace operators {
+
+namespace traits { template<typename C, typename A, typename B> struct selection_of; }
+
+/*!
+ * \brief Selects one of two values depending on a condition.
+ * \note Both values are evaluated before the selection, such that the selection compiles to a conditional move
+ *       (or a blend in vectorized code) rather than a branch.
+ */
+struct default_select_operator {
+    template<typename C, typename A, typename B>
+    constexpr auto operator()(C&& condition, A&& a, B&& b) const noexcept {
+        using result = std::common_type_t<std::remove_cvref_t<A>, std::remove_cvref_t<B>>;
+        return static_cast<bool>(condition) ? static_cast<result>(std::forward<A>(a))
+                                            : static_cast<result>(std::forward<B>(b));
+    }
+};
+
+struct select : operator_base<traits::selection_of, default_select_operator> {};
+
+}  // namespace operators
+
+//! Return an expression that evaluates to `a` where the condition holds, and to `b` otherwise
+template<expression C, expression A, expression B>
+inline constexpr auto select(const C&, const A&, const B&) noexcept {
+    if constexpr (traits::is_constant_value_v<C>)
+        return std::conditional_t<traits::is_zero_value_v<C>, B, A>{};
+    else if constexpr (traits::is_equal_node_v<A, B>)
+        return A{};
+    else
+        return operation<operators::select, C, A, B>{};
+}
+
+//! Return an expression that evaluates to the minimum of the given expressions
+template<expression A, expression B>
+inline constexpr auto min(const A& a, const B& b) noexcept {
+    return select(a < b, a, b);
+}
+
+//! Return an expression that evaluates to the maximum of the given expressions
+template<expression A, expression B>
+inline constexpr auto max(const A& a, const B& b) noexcept {
+    return select(a > b, a, b);
+}
+
+//! Return an expression that evaluates to the absolute value of the given expression
+template<expression A>
+inline constexpr auto abs(const A& a) noexcept {
+    return select(a < val<0>, -a, a);
+}
+
+namespace traits {
+
+//! The derivative of a selection is the selection of the derivatives of the branches
+template<typename C, typename T1, typename T2>
+struct derivative_of<operation<operators::select, C, T1, T2>> {
+    template<typename V>
+    static constexpr auto wrt(const type_list<V>& var) noexcept {
+        return select(C{}, xp::detail::differentiate<T1>(var), xp::detail::differentiate<T2>(var));
+    }
+};
+
+template<typename C, typename T1, typename T2>
+struct stream<operation<operators::select, C, T1, T2>> {
+    template<typename... V>
+    static constexpr void to(std::ostream& out, const bindings<V...>& values) noexcept {
+        out << "select(";
+        write_to(out, C{}, values);
+        out << ", ";
+        write_to(out, T1{}, values);
+        out << ", ";
+        write_to(out, T2{}, values);
+        out << ")";
+    }
+};
+
+}  // namespace traits
+
+//! \} group Operators
+
+}  // namespace xp
@@ -43,10 +43,32 @@ struct subtraction_of<T1, T2> {
     }
 };
 
+//! Specialization for symmetric tensors, whose differences are symmetric
+template<typename T1, typename T2, std::size_t n>
+struct subtraction_of<linalg::symmetric_tensor<T1, n>, linalg::symmetric_tensor<T2, n>> {
+    constexpr auto operator()(const linalg::symmetric_tensor<T1, n>& A,
+                              const linalg::symmetric_tensor<T2, n>& B) const noexcept {
+        return linalg::voigt_transform(A, B, std::minus{});
+    }
+};
+
+//! Specialization for structured tensors, whose differences are structured
+template<typename T1, typename T2, typename shape, typename P1, typename P2>
+struct subtraction_of<linalg::structured_tensor<T1, shape, P1>, linalg::structured_tensor<T2, shape, P2>> {
+    constexpr auto operator()(const linalg::structured_tensor<T1, shape, P1>& A,
+                              const linalg::structured_tensor<T2, shape, P2>& B) const noexcept {
+        return linalg::structured_transform(A, B, std::minus{});
+    }
+};
+
 }  // namespace traits
 
 struct subtract : operator_base<traits::subtraction_of, std::minus<void>> {};
 
+namespace traits {
+template<> struct category_of<subtract> : std::type_identity<category::accumulation> {};
+}  // namespace traits
+
 }  // namespace operators
 
 template<expression A, expression B>
@@ -56,12 +78,17 @@ inline constexpr auto operator-(const A&, const B&) noexcept {
         return -B{};
     else if constexpr (traits::is_zero_value_v<B>)
         return A{};
-    else if constexpr (std::is_same_v<A, B>)
+    else if constexpr (traits::is_equal_node_v<A, B>)
         return val<0>;
     else
         return operation<operators::subtract, A, B>{};
 }
 
+//! Differences of tensor-valued expressions of equal shape are tensor-valued
+template<tensor_valued_expression T1, tensor_valued_expression T2>
+    requires(shape_of_t<T1>{} == shape_of_t<T2>{})
+struct shape_of<operation<operators::subtract, T1, T2>> : shape_of<T1> {};
+
 namespace traits {
 
 template<typename T1, typename T2>
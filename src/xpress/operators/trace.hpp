@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Operators
+ * \brief Defines the trace operator on tensorial expressions.
+ */
+#pragma once
+
+#include <utility>
+#include <type_traits>
+
+#include "../values.hpp"
+#include "../expressions.hpp"
+#include "../linalg.hpp"
+#include "../tensor.hpp"
+#include "common.hpp"
+#include "transpose.hpp"
+
+
+namespace xp {
+
+//! \addtogroup Operators
+//! \{
+
+namespace operators {
+
+namespace traits { template<typename T> struct trace_of; }
+
+struct default_trace_operator {
+    template<tensorial T>
+    constexpr auto operator()(T&& t) const noexcept {
+        return linalg::trace_of(std::forward<T>(t));
+    }
+};
+
+struct trace : operator_base<traits::trace_of, default_trace_operator> {};
+
+namespace traits {
+template<> struct cost<trace> : std::integral_constant<std::size_t, 2> {};
+template<> struct category_of<trace> : std::type_identity<category::accumulation> {};
+}  // namespace traits
+
+}  // namespace operators
+
+template<tensor_valued_expression T>
+inline constexpr auto trace(const T&) noexcept {
+    static_assert(shape_of_t<T>{}.is_square, "Trace can only be taken on square matrices.");
+    return operation<operators::trace, T>{};
+}
+
+//! The trace of a transpose is the trace of the original expression
+template<tensor_valued_expression T>
+inline constexpr auto trace(const operation<operators::transpose, T>&) noexcept {
+    return trace(T{});
+}
+
+namespace traits {
+
+template<tensor_valued_expression T>
+struct derivative_of<operation<operators::trace, T>> {
+    template<typename V>
+    static constexpr decltype(auto) wrt(const type_list<V>& var) {
+        if constexpr (std::is_same_v<V, T>)
+            return _identity(std::make_index_sequence<shape_of_t<T>::count>{});
+        else
+            return _trace(xp::detail::differentiate<T>(var));
+    }
+
+ private:
+    template<std::size_t... k>
+    static constexpr auto _identity(std::index_sequence<k...>) noexcept {
+        static constexpr std::size_t n = shape_of_t<T>::first();
+        return tensor_expression{shape_of_t<T>{}, std::conditional_t<k/n == k%n, value<1>, value<0>>{}...};
+    }
+
+    template<tensor_valued_expression D>
+    static constexpr decltype(auto) _trace(const D& d) noexcept {
+        return trace(d);
+    }
+
+    template<expression D> requires(!tensor_valued_expression<D>)
+    static constexpr decltype(auto) _trace(const D& d) noexcept {
+        return d;
+    }
+};
+
+template<tensor_valued_expression T>
+struct stream<operation<operators::trace, T>> {
+    template<typename... V>
+    static constexpr void to(std::ostream& out, const bindings<V...>& values) noexcept {
+        out << "trace("; write_to(out, T{}, values); out << ")";
+    }
+};
+
+}  // namespace traits
+
+//! \} group Operators
+
+}  // namespace xp
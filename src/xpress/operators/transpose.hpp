@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Operators
+ * \brief Defines the transpose operator on tensorial expressions.
+ */
+#pragma once
+
+#include <type_traits>
+
+#include "../values.hpp"
+#include "../expressions.hpp"
+#include "../linalg.hpp"
+#include "common.hpp"
+
+
+namespace xp {
+
+//! \addtogroup Operators
+//! \{
+
+namespace operators {
+
+namespace traits { template<typename T> struct transpose_of; }
+
+struct default_transpose_operator {
+    template<tensorial T>
+    constexpr auto operator()(T&& t) const noexcept {
+        return linalg::transpose_of(std::forward<T>(t));
+    }
+};
+
+struct transpose : operator_base<traits::transpose_of, default_transpose_operator> {};
+
+namespace traits {
+template<> struct cost<transpose> : std::integral_constant<std::size_t, 1> {};
+}  // namespace traits
+
+}  // namespace operators
+
+template<tensor_valued_expression T>
+inline constexpr auto transpose(const T&) noexcept {
+    static_assert(shape_of_t<T>::dimensions == 2, "Transpose can only be taken on matrices.");
+    return operation<operators::transpose, T>{};
+}
+
+//! The transpose of a transpose is the original expression
+template<tensor_valued_expression T>
+inline constexpr auto transpose(const operation<operators::transpose, T>&) noexcept {
+    return T{};
+}
+
+template<tensor_valued_expression T>
+struct shape_of<operation<operators::transpose, T>>
+: std::type_identity<md_shape<shape_of_t<T>::last(), shape_of_t<T>::first()>> {};
+
+namespace traits {
+
+template<tensor_valued_expression T>
+struct derivative_of<operation<operators::transpose, T>> {
+    template<typename V>
+    static constexpr decltype(auto) wrt(const type_list<V>& var) {
+        return _transpose(xp::detail::differentiate<T>(var));
+    }
+
+ private:
+    template<tensor_valued_expression D>
+    static constexpr decltype(auto) _transpose(const D& d) noexcept {
+        return transpose(d);
+    }
+
+    template<expression D> requires(!tensor_valued_expression<D>)
+    static constexpr decltype(auto) _transpose(const D& d) noexcept {
+        return d;
+    }
+};
+
+template<tensor_valued_expression T>
+struct stream<operation<operators::transpose, T>> {
+    template<typename... V>
+    static constexpr void to(std::ostream& out, const bindings<V...>& values) noexcept {
+        out << "transpose("; write_to(out, T{}, values); out << ")";
+    }
+};
+
+}  // namespace traits
+
+//! \} group Operators
+
+}  // namespace xp
@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Operators
+ * \brief Policies to select between implementations of operators.
+ */
+#pragma once
+
+#include <type_traits>
+
+
+namespace xp {
+
+//! \addtogroup Operators
+//! \{
+
+namespace policy {
+
+//! Policy to evaluate operators with the accuracy of the standard library (the default)
+struct precise {};
+
+//! Policy to evaluate operators with fast approximations (see fast_math.hpp for their accuracy)
+struct fast {};
+
+/*!
+ * \brief Policy to evaluate operators in working types that depend on the category of the operator.
+ * \details Before evaluating an operator, its (scalar or tensorial) operands are converted to the working type of
+ *          the operator's category (see operators::traits::category_of), where `void` leaves them unchanged.
+ *          For instance, `mixed_precision<double>` evaluates sums, matrix products and determinants of values
+ *          stored as `float` in `double`. The operators themselves are evaluated with the policy `P`.
+ * \tparam accumulation The working type for operators that accumulate values (e.g. sums or matrix products)
+ * \tparam elementwise The working type for all other operators
+ * \tparam P The policy with which the operators are evaluated
+ */
+template<typename accumulation, typename elementwise = void, typename P = precise>
+struct mixed_precision {};
+
+}  // namespace policy
+
+namespace traits {
+
+//! Trait to register types as policies that can be passed to evaluations
+template<typename T>
+struct is_policy : std::false_type {};
+template<> struct is_policy<policy::precise> : std::true_type {};
+template<> struct is_policy<policy::fast> : std::true_type {};
+template<typename A, typename E, typename P> struct is_policy<policy::mixed_precision<A, E, P>> : is_policy<P> {};
+
+template<typename T>
+inline constexpr bool is_policy_v = is_policy<T>::value;
+
+}  // namespace traits
+
+//! \} group Operators
+
+}  // namespace xp
@@ -0,0 +1,155 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Expressions
+ * \brief Profiling of the evaluation of expressions.
+ */
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <ostream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "utils.hpp"
+#include "traits.hpp"
+#include "bindings.hpp"
+#include "expressions.hpp"
+
+
+namespace xp {
+
+//! \addtogroup Expressions
+//! \{
+
+/*!
+ * \brief Collects the number of evaluations and the time spent per composite node of expressions.
+ * \details Evaluations are instrumented by passing the bindings returned from `instrumented` to `value_of`.
+ *          Each node is recorded per type, and both the total time spent in a node and the time spent in the node
+ *          itself (excluding its operands) are accumulated. Evaluations with ordinary bindings are not affected
+ *          at all, since instrumentation is selected at compile time based on the type of the bindings.
+ */
+class profiler {
+    using clock = std::chrono::steady_clock;
+
+    struct handle {
+        profiler* self;
+
+        template<typename N, typename F>
+        decltype(auto) measure(F&& evaluate) const {
+            return self->template _measure<N>(std::forward<F>(evaluate));
+        }
+    };
+
+    template<typename N>
+    static constexpr char key = 0;
+
+ public:
+    using duration = clock::duration;
+
+    //! Statistics recorded for a node
+    struct record {
+        std::size_t calls = 0;
+        duration total{0};     //!< time spent in evaluations of the node, including its operands
+        duration exclusive{0}; //!< time spent in evaluations of the node, excluding its operands
+    };
+
+    //! Return bindings with the given values, for which evaluations are recorded in this profiler
+    template<typename... V>
+    auto instrumented(const bindings<V...>& values) noexcept {
+        return bindings{
+            value_binder{typename V::symbol_type{}, values[typename V::symbol_type{}]}...,
+            value_binder{detail::instrumentation_symbol{}, handle{this}}
+        };
+    }
+
+    //! Return the statistics recorded for the given node
+    template<expression N>
+    record record_of(const N&) const noexcept {
+        const auto it = _records.find(&key<N>);
+        return it != _records.end() ? it->second : record{};
+    }
+
+    //! Return the total time spent in all recorded evaluations
+    duration total_time() const noexcept {
+        duration result{0};
+        for (const auto& [_, r] : _records)
+            result += r.exclusive;
+        return result;
+    }
+
+    //! Discard all recorded statistics
+    void reset() noexcept {
+        _records.clear();
+        _operands_time = duration{0};
+    }
+
+    /*!
+     * \brief Write a report on the composite nodes of the given expression to the given stream.
+     * \details Nodes are sorted by the time spent in them, excluding their operands. The given bindings are used
+     *          to write the nodes, e.g. `with(a = "a", b = "b")`.
+     */
+    template<expression E, typename... V>
+    void write_report_to(std::ostream& out, const E&, const bindings<V...>& names) const {
+        struct line { const void* key; record r; void (*write)(std::ostream&, const bindings<V...>&); };
+        std::vector<line> lines;
+        [&] <typename... N> (const type_list<N...>&) {
+            (..., [&] () {
+                const bool is_listed = std::ranges::any_of(lines, [] (const line& l) { return l.key == &key<N>; });
+                if (!is_listed && _records.contains(&key<N>))
+                    lines.push_back({&key<N>, _records.at(&key<N>), [] (std::ostream& s, const bindings<V...>& n) {
+                        traits::stream<N>::to(s, n);
+                    }});
+            } ());
+        } (traits::composite_nodes_of_t<E>{});
+        std::ranges::sort(lines, [] (const line& a, const line& b) { return a.r.exclusive > b.r.exclusive; });
+
+        using std::chrono::duration_cast;
+        using std::chrono::nanoseconds;
+        const auto total_ns = std::max(duration_cast<nanoseconds>(total_time()).count(), nanoseconds::rep{1});
+        const double total = static_cast<double>(total_ns);
+        out << std::setw(8) << "share" << std::setw(12) << "calls" << std::setw(16) << "self [ns]" << "  node\n";
+        for (const line& l : lines) {
+            const auto self_time = duration_cast<nanoseconds>(l.r.exclusive).count();
+            out << std::fixed << std::setprecision(1) << std::setw(7) << 100.0*self_time/total << "%"
+                << std::setw(12) << l.r.calls
+                << std::setw(16) << self_time << "  ";
+            l.write(out, names);
+            out << "\n";
+        }
+    }
+
+ private:
+    template<typename N, typename F>
+    decltype(auto) _measure(F&& evaluate) {
+        record& r = _records[&key<N>];
+        const duration parent_operands_time = std::exchange(_operands_time, duration{0});
+        const auto start = clock::now();
+        decltype(auto) result = evaluate();
+        const duration elapsed = clock::now() - start;
+
+        r.calls++;
+        r.total += elapsed;
+        r.exclusive += elapsed - _operands_time;
+        _operands_time = parent_operands_time + elapsed;
+        return result;
+    }
+
+    std::unordered_map<const void*, record> _records;
+    duration _operands_time{0};
+};
+
+//! Evaluate the given expression at the given values and record the evaluation in the given profiler
+template<expression E, typename... V>
+inline auto value_of(const E& expr, const bindings<V...>& values, profiler& p) {
+    return value_of(expr, p.instrumented(values));
+}
+
+//! \} group Expressions
+
+}  // namespace xp
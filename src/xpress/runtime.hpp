@@ -0,0 +1,12 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Runtime
+ * \brief Expressions that are constructed, differentiated and evaluated at runtime.
+ */
+#pragma once
+
+#include "runtime/graph.hpp"
+#include "runtime/parser.hpp"
+#include "runtime/program.hpp"
@@ -0,0 +1,312 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Runtime
+ * \brief Expression graphs that are constructed at runtime.
+ */
+#pragma once
+
+#include <cstddef>
+#include <concepts>
+#include <functional>
+#include <unordered_map>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <array>
+#include <map>
+
+#include "../tape.hpp"
+
+
+namespace xp::runtime {
+
+//! \addtogroup Runtime
+//! \{
+
+//! Identifier of a node within a graph
+using node_id = std::size_t;
+
+//! Kinds of nodes in a runtime expression graph
+enum class node_kind : unsigned char {
+    constant,
+    symbol,
+    operation
+};
+
+//! A node in a runtime expression graph
+template<std::floating_point T>
+struct node {
+    node_kind kind;
+    bytecode::opcode code = bytecode::opcode::add;  //!< the operator (only meaningful for operations)
+    node_id lhs = 0;                                //!< the (first) operand (only meaningful for operations)
+    node_id rhs = 0;                                //!< the second operand (only meaningful for binary operations)
+    T value = T{0};                                 //!< the value (only meaningful for constants)
+    std::size_t symbol = 0;                         //!< the index of the symbol (only meaningful for symbols)
+
+    constexpr bool is_unary() const noexcept { return kind == node_kind::operation and code == bytecode::opcode::log; }
+    constexpr bool operator==(const node&) const noexcept = default;
+};
+
+/*!
+ * \brief Directed acyclic graph of expressions that are constructed at runtime.
+ * \details All nodes are stored contiguously in an arena and are identified by their index therein. Nodes are
+ *          hash-consed, that is, constructing a node that is equal to an existing one returns the existing node.
+ *          For this, operands of commutative operators are ordered by their identifiers. Since operands are
+ *          always constructed before the operations using them, the identifiers of all nodes are in topological
+ *          order. The builder functions apply the same simplifications (e.g. `0*a = 0`) as the operators on
+ *          compile-time expressions, and fold operations on constants.
+ */
+template<std::floating_point T = double>
+class graph {
+ public:
+    using value_type = T;
+
+    //! Return the node with the given identifier
+    const node<T>& operator[](node_id id) const noexcept { return _nodes[id]; }
+
+    //! Return the number of nodes in this graph
+    std::size_t size() const noexcept { return _nodes.size(); }
+
+    //! Return the number of symbols registered in this graph
+    std::size_t symbol_count() const noexcept { return _symbols.size(); }
+
+    //! Return the name of the symbol with the given index
+    std::string_view symbol_name(std::size_t index) const noexcept { return _symbols[index]; }
+
+    //! Return the index of the symbol with the given name (if it exists)
+    std::optional<std::size_t> symbol_index(std::string_view name) const noexcept {
+        for (std::size_t i = 0; i < _symbols.size(); ++i)
+            if (_symbols[i] == name)
+                return i;
+        return {};
+    }
+
+    //! Return the node representing the given constant value
+    node_id constant(T value) {
+        return _insert({.kind = node_kind::constant, .value = value});
+    }
+
+    //! Return the node representing the symbol with the given name
+    node_id symbol(std::string_view name) {
+        const auto index = symbol_index(name).or_else([&] () -> std::optional<std::size_t> {
+            _symbols.emplace_back(name);
+            return _symbols.size() - 1;
+        }).value();
+        return _insert({.kind = node_kind::symbol, .symbol = index});
+    }
+
+    node_id add(node_id a, node_id b) {
+        if (_is_constant(a, 0)) return b;
+        if (_is_constant(b, 0)) return a;
+        if (a == b) return multiply(constant(2), a);
+        return _operation(bytecode::opcode::add, a, b);
+    }
+
+    node_id subtract(node_id a, node_id b) {
+        if (_is_constant(a, 0)) return negate(b);
+        if (_is_constant(b, 0)) return a;
+        if (a == b) return constant(0);
+        return _operation(bytecode::opcode::subtract, a, b);
+    }
+
+    node_id multiply(node_id a, node_id b) {
+        if (_is_constant(a, 0) || _is_constant(b, 0)) return constant(0);
+        if (_is_constant(a, 1)) return b;
+        if (_is_constant(b, 1)) return a;
+        return _operation(bytecode::opcode::multiply, a, b);
+    }
+
+    node_id divide(node_id a, node_id b) {
+        if (_is_constant(a, 0)) return constant(0);
+        if (_is_constant(b, 1)) return a;
+        if (a == b) return constant(1);
+        return _operation(bytecode::opcode::divide, a, b);
+    }
+
+    node_id pow(node_id a, node_id b) {
+        if (_is_constant(b, 0)) return constant(1);
+        if (_is_constant(a, 1) || _is_constant(b, 1)) return a;
+        if (_is_constant(a, 0) && _nodes[b].kind == node_kind::constant && _nodes[b].value > 0) return constant(0);
+        return _operation(bytecode::opcode::pow, a, b);
+    }
+
+    node_id log(node_id a) {
+        return _operation(bytecode::opcode::log, a, a);
+    }
+
+    node_id negate(node_id a) {
+        return multiply(constant(-1), a);
+    }
+
+    //! Apply the operator with the given code to the given operands
+    node_id apply(bytecode::opcode code, node_id a, node_id b) {
+        switch (code) {
+            case bytecode::opcode::add:      return add(a, b);
+            case bytecode::opcode::subtract: return subtract(a, b);
+            case bytecode::opcode::multiply: return multiply(a, b);
+            case bytecode::opcode::divide:   return divide(a, b);
+            case bytecode::opcode::pow:      return pow(a, b);
+            case bytecode::opcode::log:      return log(a);
+        }
+        return a;
+    }
+
+    //! Return the derivative of the given expression w.r.t. the given symbol node
+    node_id derivative_of(node_id expression, node_id variable) {
+        // differentiate in post-order with an explicit stack, as chains of operations can be arbitrarily deep
+        std::vector<node_id> pending{expression};
+        while (!pending.empty()) {
+            const node_id id = pending.back();
+            if (_derivatives.contains({id, variable})) {
+                pending.pop_back();
+                continue;
+            }
+
+            const node<T> n = _nodes[id];
+            if (n.kind == node_kind::operation) {
+                const std::size_t pending_operands = pending.size();
+                if (!_derivatives.contains({n.lhs, variable}))
+                    pending.push_back(n.lhs);
+                if (!n.is_unary() && !_derivatives.contains({n.rhs, variable}))
+                    pending.push_back(n.rhs);
+                if (pending.size() != pending_operands)
+                    continue;
+            }
+
+            pending.pop_back();
+            _derivatives.emplace(std::make_pair(id, variable), _derivative_of(id, variable));
+        }
+        return _derivatives.at({expression, variable});
+    }
+
+    //! Write the given expression to the given stream
+    void write_to(std::ostream& out, node_id id) const {
+        // print via an explicit stack of pending operands and tokens, as chains of operations can be arbitrarily deep
+        struct item {
+            node_id id;
+            bool parenthesize;       // parenthesize the operand if it is an operation other than log
+            std::string_view token;  // if not empty, this item prints the token instead of an operand
+        };
+        std::vector<item> pending{{id, false, {}}};
+        while (!pending.empty()) {
+            const item i = pending.back();
+            pending.pop_back();
+            if (!i.token.empty()) {
+                out << i.token;
+                continue;
+            }
+
+            const node<T>& n = _nodes[i.id];
+            if (n.kind == node_kind::constant)
+                out << n.value;
+            else if (n.kind == node_kind::symbol)
+                out << _symbols[n.symbol];
+            else if (n.code == bytecode::opcode::log) {
+                out << "log(";
+                pending.push_back({0, false, ")"});
+                pending.push_back({n.lhs, false, {}});
+            } else {
+                if (i.parenthesize) {
+                    out << "(";
+                    pending.push_back({0, false, ")"});
+                }
+                const bool parenthesize = n.code != bytecode::opcode::add and n.code != bytecode::opcode::subtract;
+                pending.push_back({n.rhs, parenthesize, {}});
+                pending.push_back({0, false, _token_of(n.code)});
+                pending.push_back({n.lhs, parenthesize, {}});
+            }
+        }
+    }
+
+ private:
+    struct node_hash {
+        std::size_t operator()(const node<T>& n) const noexcept {
+            std::size_t h = std::hash<std::size_t>{}(
+                static_cast<std::size_t>(n.kind) | (static_cast<std::size_t>(n.code) << 8)
+            );
+            const auto combine = [&] (std::size_t v) { h ^= v + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2); };
+            combine(n.lhs);
+            combine(n.rhs);
+            combine(n.symbol);
+            combine(std::hash<T>{}(n.value));
+            return h;
+        }
+    };
+
+    // derivative of the given node, given the derivatives of its operands
+    node_id _derivative_of(node_id expression, node_id variable) {
+        const node<T> n = _nodes[expression];
+        if (n.kind == node_kind::constant)
+            return constant(0);
+        if (n.kind == node_kind::symbol)
+            return constant(expression == variable ? 1 : 0);
+
+        const node_id da = _derivatives.at({n.lhs, variable});
+        const node_id db = n.is_unary() ? constant(0) : _derivatives.at({n.rhs, variable});
+        switch (n.code) {
+            case bytecode::opcode::add: return add(da, db);
+            case bytecode::opcode::subtract: return subtract(da, db);
+            case bytecode::opcode::multiply: return add(multiply(da, n.rhs), multiply(n.lhs, db));
+            case bytecode::opcode::divide:
+                return subtract(
+                    divide(da, n.rhs),
+                    divide(multiply(n.lhs, db), multiply(n.rhs, n.rhs))
+                );
+            case bytecode::opcode::pow:
+                return add(
+                    multiply(multiply(n.rhs, pow(n.lhs, subtract(n.rhs, constant(1)))), da),
+                    multiply(multiply(expression, log(n.lhs)), db)
+                );
+            case bytecode::opcode::log: return divide(da, n.lhs);
+        }
+        return constant(0);
+    }
+
+    static constexpr std::string_view _token_of(bytecode::opcode code) noexcept {
+        switch (code) {
+            case bytecode::opcode::add: return " + ";
+            case bytecode::opcode::subtract: return " - ";
+            case bytecode::opcode::multiply: return "*";
+            case bytecode::opcode::divide: return "/";
+            case bytecode::opcode::pow: return "^";
+            case bytecode::opcode::log: break;
+        }
+        return "";
+    }
+
+    bool _is_constant(node_id id, T value) const noexcept {
+        return _nodes[id].kind == node_kind::constant and _nodes[id].value == value;
+    }
+
+    node_id _operation(bytecode::opcode code, node_id a, node_id b) {
+        if (_nodes[a].kind == node_kind::constant and _nodes[b].kind == node_kind::constant) {
+            std::array<T, 3> registers{_nodes[a].value, _nodes[b].value, T{0}};
+            bytecode::execute(bytecode::instruction{code, 0, 1, 2}, registers);
+            return constant(registers[2]);
+        }
+        if ((code == bytecode::opcode::add || code == bytecode::opcode::multiply) && b < a)
+            std::swap(a, b);
+        return _insert({.kind = node_kind::operation, .code = code, .lhs = a, .rhs = b});
+    }
+
+    node_id _insert(const node<T>& n) {
+        const auto [it, inserted] = _index.try_emplace(n, _nodes.size());
+        if (inserted)
+            _nodes.push_back(n);
+        return it->second;
+    }
+
+    std::vector<node<T>> _nodes;
+    std::vector<std::string> _symbols;
+    std::unordered_map<node<T>, node_id, node_hash> _index;
+    std::map<std::pair<node_id, node_id>, node_id> _derivatives;
+};
+
+//! \} group Runtime
+
+}  // namespace xp::runtime
@@ -0,0 +1,227 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Runtime
+ * \brief Parser for formulas given as strings.
+ */
+#pragma once
+
+#include <cctype>
+#include <charconv>
+#include <cstddef>
+#include <expected>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include "graph.hpp"
+
+
+namespace xp::runtime {
+
+//! \addtogroup Runtime
+//! \{
+
+//! Error raised when parsing a formula fails
+struct parse_error {
+    std::string message;
+    std::size_t position;  //!< position in the formula at which the error occurred
+};
+
+//! Default limit on the nesting depth (of parentheses, function calls, signs and exponents) of parsed formulas
+inline constexpr std::size_t default_max_parse_depth = 256;
+
+#ifndef DOXYGEN
+namespace detail {
+
+    template<std::floating_point T>
+    class parser {
+     public:
+        using result = std::expected<node_id, parse_error>;
+
+        parser(std::string_view formula, graph<T>& g, std::size_t max_depth) noexcept
+        : _formula{formula}
+        , _graph{g}
+        , _max_depth{max_depth}
+        {}
+
+        result parse() {
+            auto e = _sum();
+            if (e && (_skip_whitespace(), _pos != _formula.size()))
+                return _error("unexpected character '" + std::string{_formula[_pos]} + "'");
+            return e;
+        }
+
+     private:
+        // sum := product (('+' | '-') product)*
+        result _sum() {
+            auto lhs = _product();
+            while (lhs) {
+                if (_consume('+'))
+                    lhs = _apply(bytecode::opcode::add, *lhs, _product());
+                else if (_consume('-'))
+                    lhs = _apply(bytecode::opcode::subtract, *lhs, _product());
+                else
+                    break;
+            }
+            return lhs;
+        }
+
+        // product := unary (('*' | '/') unary)*
+        result _product() {
+            auto lhs = _unary();
+            while (lhs) {
+                if (_consume('*'))
+                    lhs = _apply(bytecode::opcode::multiply, *lhs, _unary());
+                else if (_consume('/'))
+                    lhs = _apply(bytecode::opcode::divide, *lhs, _unary());
+                else
+                    break;
+            }
+            return lhs;
+        }
+
+        // unary := '-' unary | power
+        // (all recursive rules pass through this one, so this is where the nesting depth is limited)
+        result _unary() {
+            if (_depth == _max_depth)
+                return _error("formula exceeds the maximum nesting depth of " + std::to_string(_max_depth));
+            ++_depth;
+            auto e = _consume('-') ? _unary().transform([&] (node_id id) { return _graph.negate(id); }) : _power();
+            --_depth;
+            return e;
+        }
+
+        // power := primary ('^' unary)?
+        result _power() {
+            auto base = _primary();
+            if (base && _consume('^'))
+                return _apply(bytecode::opcode::pow, *base, _unary());
+            return base;
+        }
+
+        // primary := number | identifier | identifier '(' arguments ')' | '(' sum ')'
+        result _primary() {
+            _skip_whitespace();
+            if (_pos == _formula.size())
+                return _error("unexpected end of formula");
+            if (_consume('(')) {
+                auto e = _sum();
+                if (e && !_consume(')'))
+                    return _error("expected ')'");
+                return e;
+            }
+
+            const char c = _formula[_pos];
+            if (std::isdigit(static_cast<unsigned char>(c)) || c == '.')
+                return _number();
+            if (std::isalpha(static_cast<unsigned char>(c)) || c == '_')
+                return _identifier();
+            return _error("unexpected character '" + std::string{c} + "'");
+        }
+
+        result _number() {
+            T value;
+            const auto [end, ec] = std::from_chars(_formula.data() + _pos, _formula.data() + _formula.size(), value);
+            if (ec != std::errc{})
+                return _error("invalid number");
+            _pos = end - _formula.data();
+            return _graph.constant(value);
+        }
+
+        result _identifier() {
+            const std::size_t begin = _pos;
+            const auto is_name_character = [] (char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '_'; };
+            while (_pos < _formula.size() && is_name_character(_formula[_pos]))
+                ++_pos;
+            const std::string_view name = _formula.substr(begin, _pos - begin);
+            if (!_consume('('))
+                return _graph.symbol(name);
+
+            std::vector<node_id> args;
+            do {
+                auto arg = _sum();
+                if (!arg)
+                    return arg;
+                args.push_back(*arg);
+            } while (_consume(','));
+            if (!_consume(')'))
+                return _error("expected ')'");
+
+            if (name == "log")
+                return _call(name, begin, args, 1, [&] () { return _graph.log(args[0]); });
+            if (name == "pow")
+                return _call(name, begin, args, 2, [&] () { return _graph.pow(args[0], args[1]); });
+            if (name == "det" || name == "mat_mul")
+                return std::unexpected(parse_error{
+                    "unsupported function '" + std::string{name} + "' (runtime expressions are scalar)", begin
+                });
+            return std::unexpected(parse_error{"unknown function '" + std::string{name} + "'", begin});
+        }
+
+        template<typename F>
+        result _call(std::string_view name,
+                     std::size_t position,
+                     const std::vector<node_id>& args,
+                     std::size_t arity,
+                     const F& f) {
+            if (args.size() != arity)
+                return std::unexpected(parse_error{
+                    "'" + std::string{name} + "' expects " + std::to_string(arity) + " argument(s)", position
+                });
+            return f();
+        }
+
+        result _apply(bytecode::opcode code, node_id lhs, const result& rhs) {
+            if (rhs)
+                return _graph.apply(code, lhs, *rhs);
+            return rhs;
+        }
+
+        bool _consume(char c) noexcept {
+            _skip_whitespace();
+            if (_pos < _formula.size() && _formula[_pos] == c) {
+                ++_pos;
+                return true;
+            }
+            return false;
+        }
+
+        void _skip_whitespace() noexcept {
+            while (_pos < _formula.size() && std::isspace(static_cast<unsigned char>(_formula[_pos])))
+                ++_pos;
+        }
+
+        std::unexpected<parse_error> _error(std::string message) const {
+            return std::unexpected(parse_error{std::move(message), _pos});
+        }
+
+        std::string_view _formula;
+        graph<T>& _graph;
+        std::size_t _max_depth;
+        std::size_t _depth = 0;
+        std::size_t _pos = 0;
+    };
+
+}  // namespace detail
+#endif  // DOXYGEN
+
+/*!
+ * \brief Parse the given formula into the given graph and return the identifier of the resulting node.
+ * \details Supports the operators `+`, `-`, `*`, `/` and `^` (right-associative) with the usual precedences,
+ *          unary minus, parentheses, numbers, symbols and the functions `pow(a, b)` and `log(a)`. Since runtime
+ *          graphs are scalar, the tensorial operators `det` and `mat_mul` are recognized but rejected. Formulas
+ *          nested deeper than `max_depth` are rejected with an error, rather than exhausting the stack.
+ */
+template<std::floating_point T>
+std::expected<node_id, parse_error> parse(std::string_view formula,
+                                          graph<T>& g,
+                                          std::size_t max_depth = default_max_parse_depth) {
+    return detail::parser<T>{formula, g, max_depth}.parse();
+}
+
+//! \} group Runtime
+
+}  // namespace xp::runtime
@@ -0,0 +1,118 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Runtime
+ * \brief Bytecode evaluation of runtime expression graphs.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "../tape.hpp"
+#include "graph.hpp"
+
+
+namespace xp::runtime {
+
+//! \addtogroup Runtime
+//! \{
+
+/*!
+ * \brief Bytecode program that evaluates one or more nodes of a runtime expression graph.
+ * \details The registers hold the values of the symbols, followed by the constants and the operations reachable
+ *          from the outputs. Constants are loaded once upon construction, and the instructions are executed with
+ *          the same `bytecode::execute` function as compile-time tapes, such that the results match the static
+ *          evaluation.
+ */
+template<std::floating_point T = double>
+class program {
+    static constexpr std::size_t unassigned = std::numeric_limits<std::size_t>::max();
+
+ public:
+    program(const graph<T>& g, std::initializer_list<node_id> outputs)
+    : program(g, std::span<const node_id>{outputs.begin(), outputs.size()})
+    {}
+
+    program(const graph<T>& g, std::span<const node_id> outputs)
+    : _symbols{g.symbol_count()} {
+        // operands precede their operations, so a single backward sweep marks all reachable nodes
+        std::vector<bool> reachable(g.size(), false);
+        for (node_id o : outputs)
+            reachable[o] = true;
+        for (node_id id = g.size(); id > 0; --id)
+            if (reachable[id-1] && g[id-1].kind == node_kind::operation)
+                reachable[g[id-1].lhs] = reachable[g[id-1].rhs] = true;
+
+        std::vector<std::size_t> register_of(g.size(), unassigned);
+        _registers.resize(_symbols, T{0});
+        for (node_id id = 0; id < g.size(); ++id) {
+            if (!reachable[id])
+                continue;
+            const node<T>& n = g[id];
+            if (n.kind == node_kind::symbol)
+                register_of[id] = n.symbol;
+            else {
+                register_of[id] = _registers.size();
+                _registers.push_back(n.kind == node_kind::constant ? n.value : T{0});
+                if (n.kind == node_kind::operation)
+                    _instructions.push_back({n.code, register_of[n.lhs], register_of[n.rhs], register_of[id]});
+            }
+        }
+
+        _outputs.reserve(outputs.size());
+        for (node_id o : outputs)
+            _outputs.push_back(register_of[o]);
+    }
+
+    //! Return the number of values expected as input, i.e. the number of symbols of the graph
+    std::size_t input_size() const noexcept { return _symbols; }
+
+    //! Return the number of outputs computed by this program
+    std::size_t output_size() const noexcept { return _outputs.size(); }
+
+    //! Return the instructions of this program
+    std::span<const bytecode::instruction> instructions() const noexcept { return _instructions; }
+
+    //! Evaluate the program for the given symbol values (ordered by symbol index) and write the outputs
+    void evaluate(std::span<const T> values, std::span<T> outputs) {
+        assert(outputs.size() == _outputs.size());
+        _run(values);
+        for (std::size_t i = 0; i < _outputs.size(); ++i)
+            outputs[i] = _registers[_outputs[i]];
+    }
+
+    //! Evaluate the first output of the program for the given symbol values (ordered by symbol index)
+    T operator()(std::span<const T> values) {
+        _run(values);
+        return _registers[_outputs[0]];
+    }
+
+    //! Evaluate the first output of the program for the given symbol values (ordered by symbol index)
+    T operator()(std::initializer_list<T> values) {
+        return (*this)(std::span<const T>{values.begin(), values.size()});
+    }
+
+ private:
+    void _run(std::span<const T> values) {
+        assert(values.size() == _symbols);
+        std::copy(values.begin(), values.end(), _registers.begin());
+        for (const bytecode::instruction& i : _instructions)
+            bytecode::execute(i, _registers);
+    }
+
+    std::size_t _symbols;
+    std::vector<T> _registers;
+    std::vector<bytecode::instruction> _instructions;
+    std::vector<std::size_t> _outputs;
+};
+
+//! \} group Runtime
+
+}  // namespace xp::runtime
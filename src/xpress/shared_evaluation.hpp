@@ -0,0 +1,169 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Expressions
+ * \brief Evaluation of multiple expressions with shared subexpressions.
+ */
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "utils.hpp"
+#include "traits.hpp"
+#include "bindings.hpp"
+#include "expressions.hpp"
+#include "operators.hpp"
+#include "tensor.hpp"
+#include "tape.hpp"
+
+
+namespace xp {
+
+//! \addtogroup Expressions
+//! \{
+
+#ifndef DOXYGEN
+namespace detail::shared_evaluation {
+
+    // unique composite nodes of the given expressions, in the order in which they can be evaluated
+    template<typename... E>
+    using composite_nodes_of_t = typename reversed<filtered_t<
+        traits::is_composite_node,
+        typename traits::detail::unique_nodes_of<traits::merged_nodes_of_t<E...>>::type
+    >>::type;
+
+    template<std::size_t i, typename... N>
+    constexpr std::tuple_element_t<i, std::tuple<N...>> node_at(const type_list<N...>&) noexcept { return {}; }
+
+    // the node of C in whose register the value of N is stored
+    template<typename N, typename C>
+    using registered_node_t = decltype(node_at<register_of<N>(C{})>(C{}));
+
+    // type of the value of node N of the nodes C when evaluated with the bindings B
+    template<typename N, typename C, typename B>
+    struct value_type;
+
+    // stand-in for the registers in unevaluated contexts, from which the value types are deduced
+    template<typename C, typename B>
+    struct register_types {
+        template<typename N>
+        const typename value_type<registered_node_t<N, C>, C, B>::type& get() const noexcept;
+    };
+
+    template<typename N, typename C, typename R, typename... V>
+    constexpr decltype(auto) operand_value(const R& computed, const bindings<V...>& values) noexcept {
+        if constexpr (traits::is_leaf_node_v<N>)
+            return traits::value_of<N>::from(values);
+        else
+            return computed.template get<N>();
+    }
+
+    template<typename C, typename op, typename... T, typename R, typename... V>
+    constexpr auto evaluated(const operation<op, T...>&, const R& computed, const bindings<V...>& values) noexcept {
+        return evaluation_operator_t<op, bindings<V...>>{}(operand_value<T, C>(computed, values)...);
+    }
+
+    template<typename C, typename shape, typename... E, typename R, typename... V>
+    constexpr auto evaluated(const tensor_expression<shape, E...>&,
+                             const R& computed,
+                             const bindings<V...>& values) noexcept {
+        return tensor_expression_value<shape, E...>([&] <typename _E> (const _E&) -> decltype(auto) {
+            return operand_value<_E, C>(computed, values);
+        });
+    }
+
+    template<typename N, typename C, typename R, typename... V>
+    constexpr auto evaluate(const R& computed, const bindings<V...>& values) noexcept {
+        if constexpr (bindings<V...>::template has_bindings_for<N>)
+            return std::remove_cvref_t<decltype(values[N{}])>{values[N{}]};
+        else
+            return instrumented_evaluation<N>(values, [&] () { return evaluated<C>(N{}, computed, values); });
+    }
+
+    template<typename N, typename C, typename B>
+    struct value_type : std::type_identity<decltype(
+        evaluate<N, C>(std::declval<const register_types<C, B>&>(), std::declval<const B&>())
+    )> {};
+
+    // the values of the nodes C, computed in order (each node only depends on nodes that precede it)
+    template<typename C, typename B, typename = C>
+    struct registers;
+    template<typename C, typename B, typename... N>
+    struct registers<C, B, type_list<N...>> {
+        constexpr explicit registers(const B& values) noexcept {
+            [&] <std::size_t... i> (std::index_sequence<i...>) {
+                (..., std::get<i>(_values).emplace(evaluate<N, C>(*this, values)));
+            } (std::index_sequence_for<N...>{});
+        }
+
+        template<typename T>
+        constexpr const auto& get() const noexcept { return *std::get<register_of<T>(C{})>(_values); }
+
+     private:
+        std::tuple<std::optional<typename value_type<N, C, B>::type>...> _values;
+    };
+
+    template<typename... E, typename... V>
+    constexpr auto values_of(const bindings<V...>& values) noexcept {
+        using nodes = composite_nodes_of_t<E...>;
+        const registers<nodes, bindings<V...>> c{values};
+        return std::tuple<std::remove_cvref_t<decltype(operand_value<E, nodes>(c, values))>...>{
+            operand_value<E, nodes>(c, values)...
+        };
+    }
+
+}  // namespace detail::shared_evaluation
+#endif  // DOXYGEN
+
+/*!
+ * \brief Exposes an interface for the evaluation of multiple expressions at once.
+ * \details Each unique subexpression of the union of all expressions is evaluated only once, and the results
+ *          are returned as a tuple. This is beneficial for families of expressions built from the same
+ *          intermediate terms.
+ */
+template<expression E1, expression E2, expression... Es>
+struct evaluator<E1, E2, Es...> {
+    constexpr evaluator(const E1&, const E2&, const Es&...) noexcept {}
+
+    //! Evaluate the expressions at the given (bound) values
+    template<binder... V>
+    constexpr auto operator()(V&&... values) const noexcept {
+        return at(bindings{std::forward<V>(values)...});
+    }
+
+    //! Evaluate the expressions at the given value bindings
+    template<typename... V>
+        requires(evaluatable_with<E1, V...> and evaluatable_with<E2, V...> and (... and evaluatable_with<Es, V...>))
+    constexpr auto operator()(const bindings<V...>& values) const noexcept {
+        return at(values);
+    }
+
+    //! Evaluate the expressions at the given (bound) values
+    template<binder... V>
+    constexpr auto at(V&&... values) const noexcept {
+        return at(bindings{std::forward<V>(values)...});
+    }
+
+    //! Evaluate the expressions at the given value bindings
+    template<typename... V>
+        requires(evaluatable_with<E1, V...> and evaluatable_with<E2, V...> and (... and evaluatable_with<Es, V...>))
+    constexpr auto at(const bindings<V...>& values) const noexcept {
+        return detail::shared_evaluation::values_of<E1, E2, Es...>(values);
+    }
+};
+
+//! Evaluate the given expressions from the given value bindings, evaluating shared subexpressions only once
+template<expression... E, typename... V>
+    requires(sizeof...(E) > 0 and (... and evaluatable_with<E, V...>))
+inline constexpr auto value_of(const std::tuple<E...>&, const bindings<V...>& values) noexcept {
+    return detail::shared_evaluation::values_of<E...>(values);
+}
+
+//! \} group Expressions
+
+}  // namespace xp
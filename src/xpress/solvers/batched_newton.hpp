@@ -0,0 +1,260 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Solvers
+ * \brief Newton solver for many independent instances of the same nonlinear equation (system).
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <xpress/concepts.hpp>
+#include <xpress/bindings.hpp>
+#include <xpress/expressions.hpp>
+#include <xpress/traits.hpp>
+#include <xpress/linalg.hpp>
+
+#include "common.hpp"
+
+
+namespace xp::solvers {
+
+//! \addtogroup Solvers
+//! \{
+
+//! Convergence status of a single instance solved in a batch
+struct lane_status {
+    bool converged = false;
+    std::size_t iterations = 0;
+};
+
+/*!
+ * \brief Finds the roots of many independent instances of the same nonlinear equation (system) using Newton's method.
+ * \details The initial guesses and parameters are bound as random-access ranges (e.g. spans or vectors) with one
+ *          entry per instance, or as scalars that are shared by all instances. The instances are processed in
+ *          batches of `lanes` instances. The residuals and Jacobians are evaluated per lane with the scalar
+ *          expression evaluation and stored in a structure-of-arrays layout, in which the linear systems of all
+ *          lanes are solved and the unknowns are updated in loops over the lanes that compilers can vectorize.
+ *          Lanes that have converged (or whose residual is no longer finite) are masked, that is, they are no longer
+ *          evaluated and their updates are blended out until all lanes of the batch are done or the maximum number
+ *          of iterations is reached. The solutions are written into the ranges bound to the unknowns.
+ */
+template<typename T = double, std::size_t lanes = 8> requires(is_scalar_v<T> and lanes > 0)
+struct batched_newton {
+    constexpr batched_newton(solver_options<T>&& opts) noexcept
+    : _opts{std::move(opts)}
+    {}
+
+    //! Find the roots of all instances and return the convergence status of each instance
+    template<expression E, typename... I>
+    constexpr std::vector<lane_status> find_roots_of(const E& equation, bindings<I...>&& initial_guesses) const {
+        using variables = traits::variables_of_t<E>;
+        const auto gradient = derivatives_of(equation, variables{});
+        const std::size_t count = _instance_count(initial_guesses, variables{});
+        std::vector<lane_status> status(count);
+        for (std::size_t begin = 0; begin < count; begin += lanes)
+            _solve_batch(equation, gradient, initial_guesses, begin, count, status, variables{});
+        return status;
+    }
+
+ private:
+    template<typename... I, typename V0, typename... V>
+    static constexpr std::size_t _instance_count(const bindings<I...>& values, const type_list<V0, V...>&) noexcept {
+        static_assert(
+            std::ranges::random_access_range<decltype(values[V0{}])>
+                && (std::ranges::random_access_range<decltype(values[V{}])> && ...),
+            "Unknowns must be bound to random-access ranges holding the initial guesses."
+        );
+        return std::ranges::size(values[V0{}]);
+    }
+
+    template<typename R>
+    static constexpr auto _lane_value(const R& values, std::size_t instance) noexcept {
+        if constexpr (is_scalar_v<std::remove_cvref_t<R>>)
+            return values;
+        else
+            return values[instance];
+    }
+
+    // bindings for a single lane, in which the unknowns are bound to their current values
+    template<typename... I, typename... V>
+    static constexpr auto _lane_bindings(const bindings<I...>& values,
+                                         std::size_t instance,
+                                         const std::array<std::array<T, lanes>, sizeof...(V)>& x,
+                                         std::size_t lane,
+                                         const type_list<V...>&) noexcept {
+        return bindings{_lane_binder<typename I::symbol_type, V...>(values, instance, x, lane)...};
+    }
+
+    template<typename S, typename... V, typename... I>
+    static constexpr auto _lane_binder(const bindings<I...>& values,
+                                       std::size_t instance,
+                                       const std::array<std::array<T, lanes>, sizeof...(V)>& x,
+                                       std::size_t lane) noexcept {
+        if constexpr (is_any_of_v<S, V...>)
+            return value_binder{S{}, T{x[_index_of<S, V...>()][lane]}};
+        else
+            return value_binder{S{}, _lane_value(values[S{}], instance)};
+    }
+
+    template<typename S, typename V0, typename... V>
+    static constexpr std::size_t _index_of() noexcept {
+        if constexpr (std::is_same_v<S, V0>)
+            return 0;
+        else
+            return 1 + _index_of<S, V...>();
+    }
+
+    template<typename E, typename G, typename... I, typename... V>
+    constexpr void _solve_batch(const E& equation,
+                                const G& gradient,
+                                bindings<I...>& values,
+                                std::size_t begin,
+                                std::size_t count,
+                                std::vector<lane_status>& status,
+                                const type_list<V...>& vars) const noexcept {
+        constexpr std::size_t n = sizeof...(V);
+        const std::size_t batch_size = std::min(lanes, count - begin);
+        // lanes beyond the number of instances duplicate the last instance, but are never active
+        const auto instance = [&] (std::size_t lane) { return begin + std::min(lane, batch_size - 1); };
+
+        std::array<std::array<T, lanes>, n> x;
+        for (std::size_t lane = 0; lane < lanes; ++lane)
+            [&] <std::size_t... j> (std::index_sequence<j...>) {
+                (..., (x[j][lane] = static_cast<T>(values[V{}][instance(lane)])));
+            } (std::make_index_sequence<n>{});
+
+        std::array<std::array<T, lanes>, n> residual{};
+        std::array<T, lanes> residual_norm_squared;
+        std::array<std::array<T, lanes>, n*n> jacobian;
+        std::array<std::array<T, lanes>, n> update;
+        std::array<bool, lanes> active;
+        std::array<bool, lanes> converged;
+        std::array<std::size_t, lanes> iterations{};
+
+        const auto threshold_squared = _opts.threshold*_opts.threshold;
+        const auto evaluate_residuals = [&] () {
+            for (std::size_t lane = 0; lane < lanes; ++lane) {
+                if (!active[lane])
+                    continue;
+                const auto lane_values = _lane_bindings(values, instance(lane), x, lane, vars);
+                _store_entries(residual, lane, value_of(equation, lane_values));
+            }
+            residual_norm_squared.fill(T{0});
+            for (std::size_t i = 0; i < n; ++i)
+                for (std::size_t lane = 0; lane < lanes; ++lane)
+                    residual_norm_squared[lane] += residual[i][lane]*residual[i][lane];
+        };
+
+        // lanes are deactivated once they converged or their residual is no longer finite
+        const auto update_status = [&] () {
+            for (std::size_t lane = 0; lane < lanes; ++lane) {
+                converged[lane] = residual_norm_squared[lane] <= threshold_squared;
+                active[lane] = active[lane] && !converged[lane] && std::isfinite(residual_norm_squared[lane]);
+            }
+        };
+
+        for (std::size_t lane = 0; lane < lanes; ++lane)
+            active[lane] = lane < batch_size;
+        evaluate_residuals();
+        update_status();
+
+        for (std::size_t iteration = 0;
+             iteration < _opts.max_iterations && std::ranges::any_of(active, std::identity{});
+             ++iteration) {
+            // inactive lanes solve with the identity, which leaves their (unused) residuals untouched
+            for (std::size_t lane = 0; lane < lanes; ++lane) {
+                if (!active[lane]) {
+                    for (std::size_t k = 0; k < n*n; ++k)
+                        jacobian[k][lane] = k%(n + 1) == 0 ? T{1} : T{0};
+                    continue;
+                }
+                const auto derivatives = gradient.at(_lane_bindings(values, instance(lane), x, lane, vars));
+                std::size_t j = 0;
+                (..., (_store_entries(jacobian, lane, derivatives[V{}], j++, n)));
+            }
+
+            _solve(jacobian, residual, update);
+            for (std::size_t j = 0; j < n; ++j)
+                for (std::size_t lane = 0; lane < lanes; ++lane)
+                    x[j][lane] -= active[lane] ? update[j][lane] : T{0};
+            for (std::size_t lane = 0; lane < lanes; ++lane)
+                iterations[lane] += active[lane];
+
+            evaluate_residuals();
+            update_status();
+        }
+
+        for (std::size_t lane = 0; lane < batch_size; ++lane) {
+            [&] <std::size_t... j> (std::index_sequence<j...>) {
+                (..., (values[V{}][begin + lane] = x[j][lane]));
+            } (std::make_index_sequence<n>{});
+            status[begin + lane] = {.converged = converged[lane], .iterations = iterations[lane]};
+        }
+    }
+
+    // store the entries of a scalar or vector value in the given column of the lane-wise storage
+    template<std::size_t rows, typename R>
+    static constexpr void _store_entries(std::array<std::array<T, lanes>, rows>& storage,
+                                         std::size_t lane,
+                                         const R& value,
+                                         std::size_t column = 0,
+                                         std::size_t columns = 1) noexcept {
+        if constexpr (is_scalar_v<R>)
+            storage[column][lane] = static_cast<T>(value);
+        else
+            visit_indices_in(shape_of_t<R>{}, [&] <std::size_t... i> (const md_index<i...>& idx) {
+                constexpr std::size_t row = md_index<i...>::as_flat_index_in(shape_of_t<R>{}).value;
+                storage[row*columns + column][lane] = static_cast<T>(access<R>::at(idx, value));
+            });
+    }
+
+    // solve the linear systems of all lanes by Gaussian elimination with lane-wise partial pivoting
+    template<std::size_t n>
+    static constexpr void _solve(std::array<std::array<T, lanes>, n*n>& A,
+                                 std::array<std::array<T, lanes>, n>& b,
+                                 std::array<std::array<T, lanes>, n>& x) noexcept {
+        const auto abs = [] (const T& v) { return v < T{0} ? -v : v; };
+        for (std::size_t k = 0; k < n; ++k) {
+            for (std::size_t lane = 0; lane < lanes; ++lane) {
+                std::size_t pivot = k;
+                for (std::size_t i = k + 1; i < n; ++i)
+                    if (abs(A[i*n + k][lane]) > abs(A[pivot*n + k][lane]))
+                        pivot = i;
+                if (pivot != k) {
+                    for (std::size_t j = k; j < n; ++j)
+                        std::swap(A[k*n + j][lane], A[pivot*n + j][lane]);
+                    std::swap(b[k][lane], b[pivot][lane]);
+                }
+            }
+            for (std::size_t i = k + 1; i < n; ++i)
+                for (std::size_t lane = 0; lane < lanes; ++lane) {
+                    const T factor = A[i*n + k][lane]/A[k*n + k][lane];
+                    for (std::size_t j = k + 1; j < n; ++j)
+                        A[i*n + j][lane] -= factor*A[k*n + j][lane];
+                    b[i][lane] -= factor*b[k][lane];
+                }
+        }
+        for (std::size_t i = n; i-- > 0;)
+            for (std::size_t lane = 0; lane < lanes; ++lane) {
+                T sum = b[i][lane];
+                for (std::size_t j = i + 1; j < n; ++j)
+                    sum -= A[i*n + j][lane]*x[j][lane];
+                x[i][lane] = sum/A[i*n + i][lane];
+            }
+    }
+
+    solver_options<T> _opts;
+};
+
+//! \} group Solvers
+
+}  // namespace xp::solvers
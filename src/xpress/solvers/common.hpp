@@ -7,9 +7,15 @@
  */
 #pragma once
 
-#include <utility>
-#include <type_traits>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <optional>
 #include <ostream>
+#include <span>
+#include <type_traits>
+#include <utility>
 
 #include <xpress/bindings.hpp>
 
@@ -25,15 +31,139 @@ inline constexpr auto starting_from(B&&... b) noexcept {
     return bindings{std::forward<B>(b)...};
 }
 
+//! Strategies for obtaining the Jacobian in Newton-type iterations
+enum class jacobian_update {
+    exact,   //!< evaluate the Jacobian in each iteration
+    chord,   //!< reuse the (inverted) Jacobian of a previous iteration
+    broyden  //!< apply Broyden's rank-one updates to the Jacobian of a previous iteration and to its inverse
+};
+
+//! Strategies for globalizing the convergence of Newton-type iterations
+enum class globalization_strategy {
+    none,         //!< take full steps
+    line_search,  //!< backtrack along the step until the Armijo condition holds for the residual norm
+    trust_region  //!< restrict the steps to a trust region along the dogleg path
+};
+
 //! Basic options for iterative solvers
 template<typename T = double>
 struct solver_options {
     T threshold;
     std::size_t max_iterations;
+    //! Verbosity of the progress output written to `std::cout` (deprecated, pass a `stream_observer` instead)
     unsigned int verbosity_level = 0;
+    //! How the Jacobian is obtained in each iteration (only considered by `newton`)
+    jacobian_update jacobian = jacobian_update::exact;
+    //! With an approximate Jacobian, the true Jacobian is re-evaluated once an iteration reduces the residual norm
+    //! by less than this factor
+    T stall_ratio = T{0.5};
+    //! How steps are controlled to converge from initial guesses far from the solution (only considered by `newton`)
+    globalization_strategy globalization = globalization_strategy::none;
+    //! Constant of the Armijo condition used in line searches
+    T sufficient_decrease = T{1e-4};
+    //! Maximum number of step reductions (or trial steps of minimizers) in line searches
+    std::size_t max_backtracking_steps = 20;
+    //! Constant of the strong Wolfe curvature condition used in the line search of minimizers
+    T curvature_condition = T{0.9};
+    //! Initial radius of the trust region
+    T trust_radius = T{1};
+};
+
+/*!
+ * \brief Statistics on a run of an iterative solver.
+ * \details The squared residual norms of the initial guess and of the iterates are recorded in a history with fixed
+ *          capacity (such that solver results remain usable in constant expressions), beyond which only the
+ *          current residual norm is updated. Times are only measured outside of constant evaluation. Least-squares
+ *          solvers and minimizers record the squared norm of the gradient as residual norm, and minimizers count
+ *          each fused evaluation of the objective and its gradient as residual evaluation.
+ */
+template<typename T = double, std::size_t history_capacity = 32>
+struct solver_statistics {
+    bool converged = false;
+    std::size_t iterations = 0;
+    std::size_t residual_evaluations = 0;
+    std::size_t jacobian_evaluations = 0;
+    std::chrono::nanoseconds residual_time{0};
+    std::chrono::nanoseconds jacobian_time{0};
+    T residual_norm_squared{0};
+    std::array<T, history_capacity> residual_history{};
+    std::size_t history_size = 0;
+
+    //! Return the recorded squared residual norms
+    constexpr std::span<const T> residuals() const noexcept {
+        return {residual_history.data(), history_size};
+    }
+
+    //! Set the current squared residual norm and add it to the history
+    constexpr void record(const T& norm_squared) noexcept {
+        residual_norm_squared = norm_squared;
+        if (history_size < history_capacity)
+            residual_history[history_size++] = norm_squared;
+    }
+};
+
+//! The (optional) result of a solver together with the statistics on the solver run
+template<typename V, typename S>
+struct solver_result : std::optional<V> {
+    S statistics;
+};
+
+//! Observer that does nothing, such that observing compiles away
+struct no_observer {
+    template<typename S>
+    constexpr void operator()(const S&) const noexcept {}
 };
 
-//! Small wrapper around an std::ostream to activate/deactivate progress output
+//! Observer that writes the progress of a solver to a stream
+class stream_observer {
+ public:
+    explicit stream_observer(std::ostream& s) noexcept : _s{s} {}
+
+    template<typename S>
+    void operator()(const S& statistics) const noexcept {
+        _s << " -- finished iteration " << statistics.iterations
+           << "; residual = " << statistics.residual_norm_squared << "\n";
+    }
+
+ private:
+    std::ostream& _s;
+};
+
+#ifndef DOXYGEN
+namespace detail {
+
+    // invoke f and add the elapsed time to the given duration (unless evaluated at compile time)
+    template<typename F>
+    constexpr auto timed(std::chrono::nanoseconds& time, const F& f) noexcept {
+        if (std::is_constant_evaluated())
+            return f();
+        const auto start = std::chrono::steady_clock::now();
+        auto result = f();
+        time += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        return result;
+    }
+
+    // return true if the given value is neither infinite nor NaN (usable in constant expressions)
+    template<typename T>
+    constexpr bool is_finite(const T& value) noexcept {
+        return value - value == T{0};
+    }
+
+    // invoke the observer, and write the progress to std::cout if requested via the deprecated verbosity level
+    template<typename T, typename Observer, typename S>
+    constexpr void notify(const Observer& observer, const solver_options<T>& opts, const S& statistics) {
+        observer(statistics);
+        if (!std::is_constant_evaluated() && opts.verbosity_level > 0)
+            stream_observer{std::cout}(statistics);
+    }
+
+}  // namespace detail
+#endif  // DOXYGEN
+
+/*!
+ * \brief Small wrapper around an std::ostream to activate/deactivate progress output
+ * \deprecated Solvers report their progress to observers (see `stream_observer`).
+ */
 class progress_logger {
  public:
     static constexpr progress_logger suppressed(std::ostream& s) noexcept { return {s, true}; }
@@ -0,0 +1,204 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Solvers
+ * \brief Parallel driver for solving many independent instances of an equation (system) on a work-stealing pool.
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <stop_token>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <xpress/expressions.hpp>
+
+
+namespace xp::solvers {
+
+//! \addtogroup Solvers
+//! \{
+
+//! Options for the parallel solution of many instances
+struct ensemble_options {
+    std::size_t number_of_threads = 0;  //!< number of worker threads (0 = std::thread::hardware_concurrency())
+    std::size_t chunk_size = 16;        //!< number of instances a worker takes at once
+};
+
+//! Statistics on the work carried out by a worker thread
+struct worker_statistics {
+    std::size_t solves = 0;         //!< number of instances solved by this worker
+    std::size_t converged = 0;      //!< number of these instances for which the solver converged
+    std::size_t chunks = 0;         //!< number of processed chunks
+    std::size_t stolen_chunks = 0;  //!< number of processed chunks that were stolen from other workers
+};
+
+#ifndef DOXYGEN
+namespace detail {
+
+    //! Range of chunk indices owned by a worker. The range is packed into a single atomic, such that the
+    //! owner can take chunks from the front while other workers concurrently steal chunks from the back.
+    class chunk_range {
+     public:
+        void assign(std::uint32_t begin, std::uint32_t end) noexcept {
+            _range.store(_pack(begin, end), std::memory_order_relaxed);
+        }
+
+        std::optional<std::uint32_t> take_front() noexcept {
+            return _take([] (std::uint32_t begin, std::uint32_t end) {
+                return std::pair{begin, _pack(begin + 1, end)};
+            });
+        }
+
+        std::optional<std::uint32_t> steal_back() noexcept {
+            return _take([] (std::uint32_t begin, std::uint32_t end) {
+                return std::pair{end - 1, _pack(begin, end - 1)};
+            });
+        }
+
+     private:
+        template<typename F>
+        std::optional<std::uint32_t> _take(const F& split) noexcept {
+            std::uint64_t current = _range.load(std::memory_order_relaxed);
+            while (true) {
+                const std::uint32_t begin = static_cast<std::uint32_t>(current >> 32);
+                const std::uint32_t end = static_cast<std::uint32_t>(current);
+                if (begin >= end)
+                    return {};
+                const auto [chunk, remaining] = split(begin, end);
+                if (_range.compare_exchange_weak(current, remaining, std::memory_order_acq_rel))
+                    return chunk;
+            }
+        }
+
+        static constexpr std::uint64_t _pack(std::uint32_t begin, std::uint32_t end) noexcept {
+            return (static_cast<std::uint64_t>(begin) << 32) | end;
+        }
+
+        // separate cache lines for the ranges of different workers
+        alignas(64) std::atomic<std::uint64_t> _range{0};
+    };
+
+}  // namespace detail
+#endif  // DOXYGEN
+
+/*!
+ * \brief Solves many independent instances of an equation (system) in parallel with the given solver.
+ * \details The instances are split into chunks, which are initially distributed evenly among the workers. A worker
+ *          that has processed all of its chunks steals chunks from the back of the other workers' ranges, such that
+ *          instances with very different solution costs are balanced among the threads. The result of each
+ *          instance is written into its slot of a preallocated output range, and thus, the results do not depend
+ *          on the number of threads or on the schedule. The solver is shared by all threads and must therefore
+ *          support concurrent calls to `find_root_of`.
+ */
+template<typename Solver>
+class ensemble {
+ public:
+    explicit ensemble(Solver solver, ensemble_options opts = {}) noexcept
+    : _solver{std::move(solver)}
+    , _opts{std::move(opts)}
+    {}
+
+    /*!
+     * \brief Solve the instances `i = 0, ..., size(results) - 1` and write their results into `results[i]`.
+     * \param equation The equation (system) to be solved.
+     * \param initial_guess_of Returns the bindings with the initial guess (and parameters) for an instance index.
+     * \param results Preallocated range into which the (optional) solution of each instance is written.
+     * \return The statistics of each worker thread.
+     * \note If the solver or `initial_guess_of` throws, the remaining chunks are skipped and the first exception is
+     *       rethrown once all workers have finished.
+     */
+    template<expression E, std::invocable<std::size_t> G, std::ranges::random_access_range R>
+        requires(std::ranges::sized_range<R>)
+    std::vector<worker_statistics> solve(const E& equation, const G& initial_guess_of, R&& results) const {
+        const std::size_t count = std::ranges::size(results);
+        const std::size_t chunk_size = std::max(_opts.chunk_size, std::size_t{1});
+        const std::size_t number_of_chunks = (count + chunk_size - 1)/chunk_size;
+        if (number_of_chunks > std::numeric_limits<std::uint32_t>::max())
+            throw std::length_error("Number of chunks exceeds the supported range.");
+
+        const std::size_t number_of_workers = std::max(
+            std::min(_number_of_threads(), number_of_chunks), std::size_t{1}
+        );
+        std::vector<detail::chunk_range> ranges(number_of_workers);
+        for (std::size_t w = 0; w < number_of_workers; ++w)
+            ranges[w].assign(
+                static_cast<std::uint32_t>(number_of_chunks*w/number_of_workers),
+                static_cast<std::uint32_t>(number_of_chunks*(w + 1)/number_of_workers)
+            );
+
+        std::vector<worker_statistics> statistics(number_of_workers);
+        std::stop_source stop;
+        std::exception_ptr error;
+        const auto work = [&] (std::size_t worker) {
+            worker_statistics stats;  // accumulated locally to avoid false sharing among the workers
+            const auto process = [&] (std::uint32_t chunk) {
+                const std::size_t end = std::min(count, (chunk + 1)*chunk_size);
+                for (std::size_t i = chunk*chunk_size; i < end; ++i) {
+                    auto result = _solver.find_root_of(equation, std::invoke(initial_guess_of, i));
+                    stats.converged += static_cast<bool>(result);
+                    results[i] = std::move(result);
+                }
+                stats.solves += end - chunk*chunk_size;
+                stats.chunks++;
+            };
+
+            while (const auto chunk = !stop.stop_requested() ? ranges[worker].take_front() : std::nullopt)
+                process(*chunk);
+            // visit the other workers in a fixed order and steal until no work is left anywhere
+            for (std::size_t offset = 1; offset < number_of_workers; ++offset)
+                while (const auto chunk = !stop.stop_requested()
+                                            ? ranges[(worker + offset) % number_of_workers].steal_back()
+                                            : std::nullopt) {
+                    process(*chunk);
+                    stats.stolen_chunks++;
+                }
+            statistics[worker] = stats;
+        };
+        // exceptions must not escape the threads, so the first one is kept and the other workers are stopped
+        const auto guarded_work = [&] (std::size_t worker) noexcept {
+            try {
+                work(worker);
+            } catch (...) {
+                if (stop.request_stop())
+                    error = std::current_exception();
+            }
+        };
+
+        {
+            std::vector<std::jthread> threads;
+            threads.reserve(number_of_workers - 1);
+            for (std::size_t w = 1; w < number_of_workers; ++w)
+                threads.emplace_back(guarded_work, w);
+            guarded_work(0);
+        }
+        if (error)
+            std::rethrow_exception(error);
+        return statistics;
+    }
+
+ private:
+    std::size_t _number_of_threads() const noexcept {
+        if (_opts.number_of_threads > 0)
+            return _opts.number_of_threads;
+        return std::max(static_cast<std::size_t>(std::thread::hardware_concurrency()), std::size_t{1});
+    }
+
+    Solver _solver;
+    ensemble_options _opts;
+};
+
+//! \} group Solvers
+
+}  // namespace xp::solvers
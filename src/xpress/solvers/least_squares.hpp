@@ -0,0 +1,376 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Solvers
+ * \brief Gauss-Newton and Levenberg-Marquardt solvers for nonlinear least-squares problems.
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <xpress/concepts.hpp>
+#include <xpress/bindings.hpp>
+#include <xpress/expressions.hpp>
+#include <xpress/traits.hpp>
+#include <xpress/linalg.hpp>
+#include <xpress/tensor.hpp>
+
+#include "common.hpp"
+#include "sparse_newton.hpp"
+
+
+namespace xp::solvers {
+
+//! \addtogroup Solvers
+//! \{
+
+#ifndef DOXYGEN
+namespace detail {
+
+    // expression of the derivative of residual k/n w.r.t. the unknown k%n
+    template<typename E, std::size_t k, typename... U>
+    using residual_derivative_t = jacobian_entry_t<
+        std::remove_cvref_t<decltype(E{}[md_ic<k/sizeof...(U)>])>,
+        std::tuple_element_t<k%sizeof...(U), std::tuple<U...>>
+    >;
+
+    /*!
+     * \brief Compile-time plan for assembling the normal equations J^T J and J^T r of a least-squares problem.
+     * \details Only the structurally non-zero entries of the (m x n) Jacobian J are evaluated and stored in a
+     *          compressed array. The products of J^T J are restricted to pairs of non-zero entries in the same row,
+     *          and only one triangle of the symmetric matrix is assembled (in Voigt storage).
+     */
+    template<std::size_t m, std::size_t n, auto pattern>
+    struct normal_equations_plan {
+        struct product {
+            std::size_t first;   // position of the first factor in the compressed Jacobian
+            std::size_t second;  // position of the second factor in the compressed Jacobian
+            std::size_t target;  // position in the Voigt storage of J^T J
+        };
+
+        static constexpr std::size_t nonzeros = [] () {
+            std::size_t count = 0;
+            for (bool is_nonzero : pattern)
+                count += is_nonzero;
+            return count;
+        } ();
+
+        //! flat indices (row*n + column) of the non-zero Jacobian entries
+        static constexpr std::array<std::size_t, nonzeros> jacobian_entries = [] () {
+            std::array<std::size_t, nonzeros> result{};
+            for (std::size_t k = 0, q = 0; k < m*n; ++k)
+                if (pattern[k])
+                    result[q++] = k;
+            return result;
+        } ();
+
+     private:
+        template<typename Action>
+        static constexpr void _visit_products(const Action& action) noexcept {
+            for (std::size_t p = 0; p < nonzeros; ++p)
+                for (std::size_t q = p; q < nonzeros && jacobian_entries[q]/n == jacobian_entries[p]/n; ++q)
+                    action(p, q);
+        }
+
+     public:
+        static constexpr std::size_t product_count = [] () {
+            std::size_t count = 0;
+            _visit_products([&] (std::size_t, std::size_t) { ++count; });
+            return count;
+        } ();
+
+        static constexpr std::array<product, product_count> products = [] () {
+            std::array<product, product_count> result{};
+            std::size_t i = 0;
+            _visit_products([&] (std::size_t p, std::size_t q) {
+                const std::size_t column_p = jacobian_entries[p]%n;
+                const std::size_t column_q = jacobian_entries[q]%n;
+                result[i++] = {p, q, linalg::symmetric_tensor<double, n>::voigt_index(column_p, column_q)};
+            });
+            return result;
+        } ();
+    };
+
+    template<typename E, typename... U>
+    constexpr auto normal_equations_plan_for() noexcept {
+        constexpr std::size_t m = shape_of_t<E>::count;
+        constexpr auto pattern = jacobian_pattern<E, U...>(std::make_index_sequence<m>{});
+        return normal_equations_plan<m, sizeof...(U), pattern>{};
+    }
+
+    //! Evaluates the residuals and the normal equations of a least-squares problem
+    template<typename T, typename E, typename... U>
+    struct least_squares_problem {
+        static constexpr std::size_t m = shape_of_t<E>::count;
+        static constexpr std::size_t n = sizeof...(U);
+        using residuals = std::array<T, m>;
+        using matrix = linalg::symmetric_tensor<T, n>;
+        using vector = linalg::tensor<T, md_shape<n>>;
+        using plan = decltype(normal_equations_plan_for<E, U...>());
+
+        static_assert(shape_of_t<E>::dimensions == 1, "Least-squares solvers expect a vector of residuals.");
+        static_assert(m >= n, "Least-squares problems require at least as many residuals as unknowns.");
+
+        template<typename B>
+        static constexpr residuals residuals_at(const B& solution) noexcept {
+            residuals r{};
+            const auto values = value_of(E{}, solution);
+            visit_indices_in(shape<m>, [&] <std::size_t i> (const md_index<i>& idx) {
+                r[i] = static_cast<T>(access<std::remove_cvref_t<decltype(values)>>::at(idx, values));
+            });
+            return r;
+        }
+
+        static constexpr T cost_of(const residuals& r) noexcept {
+            T result{0};
+            for (const auto& v : r)
+                result += v*v;
+            return result/T{2};
+        }
+
+        //! Return J^T J and J^T r at the given solution
+        template<typename B>
+        static constexpr std::pair<matrix, vector> normal_equations_at(const B& solution,
+                                                                       const residuals& r) noexcept {
+            std::array<T, plan::nonzeros> jacobian;
+            [&] <std::size_t... q> (std::index_sequence<q...>) {
+                (..., (jacobian[q] = static_cast<T>(
+                    value_of(residual_derivative_t<E, plan::jacobian_entries[q], U...>{}, solution)
+                )));
+            } (std::make_index_sequence<plan::nonzeros>{});
+
+            std::array<T, matrix::voigt_size> jtj{};
+            for (const auto& p : plan::products)
+                jtj[p.target] += jacobian[p.first]*jacobian[p.second];
+            vector jtr{T{0}};
+            for (std::size_t q = 0; q < plan::nonzeros; ++q)
+                jtr[plan::jacobian_entries[q]%n] += jacobian[q]*r[plan::jacobian_entries[q]/n];
+            return {matrix{std::move(jtj)}, std::move(jtr)};
+        }
+
+        static constexpr T squared_norm_of(const vector& v) noexcept {
+            T result{0};
+            for (std::size_t i = 0; i < n; ++i)
+                result += v[i]*v[i];
+            return result;
+        }
+
+        template<typename B>
+        static constexpr void apply(B& solution, const vector& step) noexcept {
+            [&] <std::size_t... j> (std::index_sequence<j...>) {
+                (..., (value_of_unknown(solution, U{}) -= step[j]));
+            } (std::make_index_sequence<n>{});
+        }
+
+        template<typename B>
+        static constexpr vector unknowns_of(const B& solution) noexcept {
+            return vector{md_shape<n>{}, static_cast<T>(value_of_unknown(solution, U{}))...};
+        }
+
+        template<typename B>
+        static constexpr void assign(B& solution, const vector& values) noexcept {
+            [&] <std::size_t... j> (std::index_sequence<j...>) {
+                (..., (value_of_unknown(solution, U{}) = values[j]));
+            } (std::make_index_sequence<n>{});
+        }
+    };
+
+    template<typename T, typename E, typename... U>
+    constexpr auto least_squares_problem_for(const type_list<U...>&) noexcept {
+        return least_squares_problem<T, E, U...>{};
+    }
+
+    // evaluate the residuals of a problem and record the evaluation in the given statistics
+    template<typename problem, typename B, typename S>
+    constexpr auto evaluate_residuals(const B& solution, S& statistics) noexcept {
+        statistics.residual_evaluations++;
+        return timed(statistics.residual_time, [&] () {
+            return problem::residuals_at(solution);
+        });
+    }
+
+    // evaluate the normal equations of a problem and record the (Jacobian) evaluation in the given statistics
+    template<typename problem, typename B, typename S>
+    constexpr auto evaluate_normal_equations(const B& solution,
+                                             const typename problem::residuals& r,
+                                             S& statistics) noexcept {
+        statistics.jacobian_evaluations++;
+        return timed(statistics.jacobian_time, [&] () {
+            return problem::normal_equations_at(solution, r);
+        });
+    }
+
+}  // namespace detail
+#endif  // DOXYGEN
+
+/*!
+ * \brief Minimizes the sum of squared residuals of a vector expression with the Gauss-Newton method.
+ * \details In each iteration, the normal equations `J^T J dx = J^T r` are assembled from the symbolic derivatives
+ *          of the residuals, where products of structurally zero Jacobian entries are skipped at compile time, and
+ *          solved via a Cholesky factorization. The iteration converges once the norm of the gradient `J^T r` falls
+ *          below the threshold. Returns an empty result if the iteration does not converge (including iterations
+ *          that stagnate with updates below the threshold, or whose gradient is not finite) or if `J^T J` is not
+ *          positive definite (rank-deficient Jacobian). The results carry statistics on the solver run, and the
+ *          given observer is invoked with these statistics after each iteration.
+ */
+template<typename T = double, typename Observer = no_observer> requires(is_scalar_v<T>)
+struct gauss_newton {
+    using statistics_type = solver_statistics<T>;
+
+    constexpr gauss_newton(solver_options<T>&& opts, Observer observer = {}) noexcept
+    : _opts{std::move(opts)}
+    , _observer{std::move(observer)}
+    {}
+
+    //! Find the least-squares solution of the given residuals w.r.t. their variables
+    template<tensorial_expression E, typename... I>
+    constexpr auto find_least_squares_solution_of(const E& residuals, bindings<I...>&& initial_guess) const noexcept {
+        return find_least_squares_solution_of(residuals, traits::variables_of_t<E>{}, std::move(initial_guess));
+    }
+
+    //! Find the least-squares solution of the given residuals w.r.t. the given unknowns
+    template<tensorial_expression E, typename... U, typename... I>
+    constexpr auto find_least_squares_solution_of(const E&,
+                                                  const type_list<U...>&,
+                                                  bindings<I...>&& initial_guess) const noexcept {
+        using problem = decltype(detail::least_squares_problem_for<T, E>(
+            typename detail::scalar_unknowns<U...>::type{}
+        ));
+        using result_t = solver_result<bindings<I...>, statistics_type>;
+        statistics_type statistics;
+        const auto threshold_squared = _opts.threshold*_opts.threshold;
+        auto residuals = detail::evaluate_residuals<problem>(initial_guess, statistics);
+        auto [jtj, jtr] = detail::evaluate_normal_equations<problem>(initial_guess, residuals, statistics);
+        statistics.record(problem::squared_norm_of(jtr));
+        for (bool is_step_small = false; !is_step_small && !(statistics.residual_norm_squared <= threshold_squared);) {
+            if (statistics.iterations >= _opts.max_iterations || !detail::is_finite(statistics.residual_norm_squared))
+                return result_t{{}, statistics};
+
+            const auto step = linalg::cholesky_solve(jtj, jtr);
+            if (!step)  // rank-deficient Jacobian
+                return result_t{{}, statistics};
+            problem::apply(initial_guess, *step);
+            residuals = detail::evaluate_residuals<problem>(initial_guess, statistics);
+            std::tie(jtj, jtr) = detail::evaluate_normal_equations<problem>(initial_guess, residuals, statistics);
+            is_step_small = problem::squared_norm_of(*step) <= threshold_squared;
+
+            statistics.iterations++;
+            statistics.record(problem::squared_norm_of(jtr));
+            detail::notify(_observer, _opts, std::as_const(statistics));
+        }
+
+        if (!(statistics.residual_norm_squared <= threshold_squared))  // stagnated with a large gradient
+            return result_t{{}, statistics};
+        statistics.converged = true;
+        return result_t{{std::move(initial_guess)}, statistics};
+    }
+
+ private:
+    solver_options<T> _opts;
+    Observer _observer;
+};
+
+//! Options for the damping in the Levenberg-Marquardt method
+template<typename T = double>
+struct damping_options {
+    T initial = T{1e-3};  //!< initial damping parameter
+    T factor = T{10};     //!< factor by which the damping is decreased/increased on accepted/rejected steps
+};
+
+/*!
+ * \brief Minimizes the sum of squared residuals of a vector expression with the Levenberg-Marquardt method.
+ * \details Solves the damped normal equations `(J^T J + lambda diag(J^T J)) dx = J^T r`, assembled and solved as in
+ *          the Gauss-Newton method. Steps that do not decrease the sum of squared residuals are rejected and the
+ *          damping is increased, while accepted steps decrease it. Rejected trial steps only cost a residual
+ *          evaluation, since the Jacobian is only evaluated at accepted points. The results carry statistics on the
+ *          solver run, and the given observer is invoked with these statistics after each iteration.
+ */
+template<typename T = double, typename Observer = no_observer> requires(is_scalar_v<T>)
+struct levenberg_marquardt {
+    using statistics_type = solver_statistics<T>;
+
+    constexpr levenberg_marquardt(solver_options<T>&& opts,
+                                  damping_options<T> damping = {},
+                                  Observer observer = {}) noexcept
+    : _opts{std::move(opts)}
+    , _damping{std::move(damping)}
+    , _observer{std::move(observer)}
+    {}
+
+    //! Find the least-squares solution of the given residuals w.r.t. their variables
+    template<tensorial_expression E, typename... I>
+    constexpr auto find_least_squares_solution_of(const E& residuals, bindings<I...>&& initial_guess) const noexcept {
+        return find_least_squares_solution_of(residuals, traits::variables_of_t<E>{}, std::move(initial_guess));
+    }
+
+    //! Find the least-squares solution of the given residuals w.r.t. the given unknowns
+    template<tensorial_expression E, typename... U, typename... I>
+    constexpr auto find_least_squares_solution_of(const E&,
+                                                  const type_list<U...>&,
+                                                  bindings<I...>&& initial_guess) const noexcept {
+        using problem = decltype(detail::least_squares_problem_for<T, E>(
+            typename detail::scalar_unknowns<U...>::type{}
+        ));
+        using result_t = solver_result<bindings<I...>, statistics_type>;
+        statistics_type statistics;
+        const auto threshold_squared = _opts.threshold*_opts.threshold;
+
+        T damping = _damping.initial;
+        auto residuals = detail::evaluate_residuals<problem>(initial_guess, statistics);
+        auto cost = problem::cost_of(residuals);
+        auto [jtj, jtr] = detail::evaluate_normal_equations<problem>(initial_guess, residuals, statistics);
+        statistics.record(problem::squared_norm_of(jtr));
+        for (bool is_step_small = false; !is_step_small && !(statistics.residual_norm_squared <= threshold_squared);) {
+            if (statistics.iterations >= _opts.max_iterations || !detail::is_finite(statistics.residual_norm_squared))
+                return result_t{{}, statistics};
+
+            auto damped = jtj;
+            for (std::size_t i = 0; i < problem::n; ++i)
+                damped.voigt()[i] += damping*jtj.voigt()[i];
+            if (const auto step = linalg::cholesky_solve(damped, jtr); !step) {
+                damping *= _damping.factor;
+            } else {
+                const auto unknowns = problem::unknowns_of(initial_guess);
+                problem::apply(initial_guess, *step);
+                const auto trial_residuals = detail::evaluate_residuals<problem>(initial_guess, statistics);
+                const auto trial_cost = problem::cost_of(trial_residuals);
+                if (trial_cost < cost) {
+                    damping /= _damping.factor;
+                    residuals = trial_residuals;
+                    cost = trial_cost;
+                    std::tie(jtj, jtr) = detail::evaluate_normal_equations<problem>(
+                        initial_guess, residuals, statistics
+                    );
+                    is_step_small = problem::squared_norm_of(*step) <= threshold_squared;
+                } else {
+                    damping *= _damping.factor;
+                    problem::assign(initial_guess, unknowns);
+                }
+            }
+
+            statistics.iterations++;
+            statistics.record(problem::squared_norm_of(jtr));
+            detail::notify(_observer, _opts, std::as_const(statistics));
+        }
+
+        if (!(statistics.residual_norm_squared <= threshold_squared))  // stagnated with a large gradient
+            return result_t{{}, statistics};
+        statistics.converged = true;
+        return result_t{{std::move(initial_guess)}, statistics};
+    }
+
+ private:
+    solver_options<T> _opts;
+    damping_options<T> _damping;
+    Observer _observer;
+};
+
+//! \} group Solvers
+
+}  // namespace xp::solvers
@@ -0,0 +1,391 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Solvers
+ * \brief Gradient-based minimizers for scalar expressions.
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <xpress/concepts.hpp>
+#include <xpress/bindings.hpp>
+#include <xpress/expressions.hpp>
+#include <xpress/traits.hpp>
+#include <xpress/shared_evaluation.hpp>
+
+#include "common.hpp"
+#include "sparse_newton.hpp"
+
+
+namespace xp::solvers {
+
+//! \addtogroup Solvers
+//! \{
+
+#ifndef DOXYGEN
+namespace detail {
+
+    //! Evaluates a scalar objective together with its gradient w.r.t. the given scalar unknowns
+    template<typename T, typename E, typename... U>
+    struct objective {
+        static constexpr std::size_t n = sizeof...(U);
+        using scalar = T;
+        using vector = std::array<T, n>;
+
+        //! The value and the gradient, computed in a single pass in which shared subexpressions are evaluated once
+        template<typename B>
+        static constexpr std::pair<T, vector> value_and_gradient_at(const B& solution) noexcept {
+            const auto values = value_of(std::tuple<E, jacobian_entry_t<E, U>...>{}, solution);
+            return [&] <std::size_t... j> (std::index_sequence<j...>) {
+                return std::pair<T, vector>{
+                    static_cast<T>(std::get<0>(values)),
+                    vector{static_cast<T>(std::get<j + 1>(values))...}
+                };
+            } (std::make_index_sequence<n>{});
+        }
+
+        template<typename B>
+        static constexpr vector unknowns_of(const B& solution) noexcept {
+            return vector{static_cast<T>(value_of_unknown(solution, U{}))...};
+        }
+
+        //! Set the unknowns to x + alpha*p
+        template<typename B>
+        static constexpr void assign(B& solution, const vector& x, const T& alpha, const vector& p) noexcept {
+            [&] <std::size_t... j> (std::index_sequence<j...>) {
+                (..., (value_of_unknown(solution, U{}) = x[j] + alpha*p[j]));
+            } (std::make_index_sequence<n>{});
+        }
+
+        static constexpr T dot(const vector& a, const vector& b) noexcept {
+            T result{0};
+            for (std::size_t i = 0; i < n; ++i)
+                result += a[i]*b[i];
+            return result;
+        }
+    };
+
+    template<typename T, typename E, typename... U>
+    constexpr auto objective_for(const type_list<U...>&) noexcept {
+        return objective<T, E, U...>{};
+    }
+
+    //! State of an iterate, i.e. the objective value and gradient at the current unknowns
+    template<typename T, std::size_t n>
+    struct iterate {
+        T value;
+        std::array<T, n> gradient;
+    };
+
+    // evaluate the objective and its gradient and record the evaluation in the given statistics
+    template<typename problem, typename B, typename S>
+    constexpr auto evaluate(const B& solution, S& statistics) noexcept {
+        statistics.residual_evaluations++;
+        return timed(statistics.residual_time, [&] () {
+            auto [value, gradient] = problem::value_and_gradient_at(solution);
+            return iterate<typename problem::scalar, problem::n>{value, gradient};
+        });
+    }
+
+    /*!
+     * \brief Line search along the descent direction p for a step satisfying the strong Wolfe conditions.
+     * \details Brackets an interval containing acceptable steps by expanding the trial step and then shrinks it
+     *          via safeguarded quadratic interpolation (see Nocedal & Wright, Numerical Optimization, Alg. 3.5/3.6).
+     *          Each trial step costs a single fused evaluation of the objective and its gradient, and the accepted
+     *          trial is returned such that the next iteration can reuse it. Upon failure, the unknowns are reset.
+     */
+    template<typename problem, typename T, typename B, typename S>
+    constexpr std::optional<std::pair<T, iterate<T, problem::n>>> strong_wolfe_search(
+        B& solution,
+        const iterate<T, problem::n>& start,
+        const typename problem::vector& p,
+        T alpha,
+        const solver_options<T>& opts,
+        S& statistics
+    ) noexcept {
+        using result_t = std::optional<std::pair<T, iterate<T, problem::n>>>;
+        const auto x = problem::unknowns_of(solution);
+        const T slope = problem::dot(start.gradient, p);
+        const auto trial = [&] (const T& a) {
+            problem::assign(solution, x, a, p);
+            return evaluate<problem>(solution, statistics);
+        };
+        const auto is_sufficient = [&] (const T& a, const iterate<T, problem::n>& s) {
+            return s.value <= start.value + opts.sufficient_decrease*a*slope;
+        };
+        const auto has_curvature = [&] (const iterate<T, problem::n>& s) {
+            const T s_slope = problem::dot(s.gradient, p);
+            return (s_slope < T{0} ? -s_slope : s_slope) <= -opts.curvature_condition*slope;
+        };
+
+        // shrink the interval between lo and hi, where lo is the best step found so far
+        const auto zoom = [&] (T lo, iterate<T, problem::n> at_lo, T hi, iterate<T, problem::n> at_hi,
+                               std::size_t evaluations) -> result_t {
+            for (; evaluations < opts.max_backtracking_steps; ++evaluations) {
+                const T slope_lo = problem::dot(at_lo.gradient, p);
+                const T width = hi - lo;
+                const T denominator = T{2}*(at_hi.value - at_lo.value - slope_lo*width);
+                T a = denominator > T{0} ? lo - slope_lo*width*width/denominator : lo + width/T{2};
+                const T lower = std::min(lo, hi) + T{0.1}*(width < T{0} ? -width : width);
+                const T upper = std::max(lo, hi) - T{0.1}*(width < T{0} ? -width : width);
+                if (!(a >= lower && a <= upper))
+                    a = lo + width/T{2};
+
+                const auto at_a = trial(a);
+                if (!is_sufficient(a, at_a) || at_a.value >= at_lo.value) {
+                    hi = a;
+                    at_hi = at_a;
+                } else {
+                    if (has_curvature(at_a))
+                        return std::pair{a, at_a};
+                    if (problem::dot(at_a.gradient, p)*width >= T{0}) {
+                        hi = lo;
+                        at_hi = at_lo;
+                    }
+                    lo = a;
+                    at_lo = at_a;
+                }
+            }
+            return result_t{};
+        };
+
+        T previous = T{0};
+        iterate<T, problem::n> at_previous = start;
+        for (std::size_t evaluations = 0; evaluations < opts.max_backtracking_steps; ++evaluations) {
+            const auto at_alpha = trial(alpha);
+            if (!is_sufficient(alpha, at_alpha) || (evaluations > 0 && at_alpha.value >= at_previous.value)) {
+                if (auto result = zoom(previous, at_previous, alpha, at_alpha, evaluations + 1))
+                    return result;
+                break;
+            }
+            if (has_curvature(at_alpha))
+                return std::pair{alpha, at_alpha};
+            if (problem::dot(at_alpha.gradient, p) >= T{0}) {
+                if (auto result = zoom(alpha, at_alpha, previous, at_previous, evaluations + 1))
+                    return result;
+                break;
+            }
+            previous = alpha;
+            at_previous = at_alpha;
+            alpha *= T{2};
+        }
+
+        problem::assign(solution, x, T{0}, p);
+        return result_t{};
+    }
+
+}  // namespace detail
+#endif  // DOXYGEN
+
+/*!
+ * \brief Minimizes scalar expressions using the limited-memory BFGS method.
+ * \details The inverse Hessian is approximated from the last `history` pairs of changes in the unknowns and the
+ *          gradient, which are stored in a fixed-size ring buffer. Steps are determined by a line search satisfying
+ *          the strong Wolfe conditions (see `solver_options::sufficient_decrease` and
+ *          `solver_options::curvature_condition`), in which each trial evaluates the objective and its gradient in
+ *          a single fused pass over the expression. The iteration stops once the gradient norm falls below the
+ *          threshold. The results carry statistics on the solver run, and the given observer is invoked with these
+ *          statistics after each iteration.
+ */
+template<typename T = double, std::size_t history = 8, typename Observer = no_observer>
+    requires(is_scalar_v<T> and history > 0)
+struct lbfgs {
+    using statistics_type = solver_statistics<T>;
+
+    constexpr lbfgs(solver_options<T>&& opts, Observer observer = {}) noexcept
+    : _opts{std::move(opts)}
+    , _observer{std::move(observer)}
+    {}
+
+    //! Find a minimum of the given scalar expression w.r.t. its variables
+    template<expression E, typename... I>
+    constexpr auto find_minimum_of(const E& objective, bindings<I...>&& initial_guess) const noexcept {
+        return find_minimum_of(objective, traits::variables_of_t<E>{}, std::move(initial_guess));
+    }
+
+    //! Find a minimum of the given scalar expression w.r.t. the given unknowns
+    template<expression E, typename... U, typename... I>
+    constexpr auto find_minimum_of(const E&,
+                                   const type_list<U...>&,
+                                   bindings<I...>&& initial_guess) const noexcept {
+        using problem = decltype(detail::objective_for<T, E>(typename detail::scalar_unknowns<U...>::type{}));
+        using vector = typename problem::vector;
+        using result_t = solver_result<bindings<I...>, statistics_type>;
+        constexpr std::size_t n = problem::n;
+
+        std::array<vector, history> s;
+        std::array<vector, history> y;
+        std::array<T, history> rho{};
+        std::size_t newest = 0;
+        std::size_t count = 0;
+
+        statistics_type statistics;
+        auto current = detail::evaluate<problem>(initial_guess, statistics);
+        statistics.record(problem::dot(current.gradient, current.gradient));
+        const auto threshold_squared = _opts.threshold*_opts.threshold;
+        while (!(statistics.residual_norm_squared <= threshold_squared) || !detail::is_finite(current.value)) {
+            if (statistics.iterations >= _opts.max_iterations
+                    || !detail::is_finite(current.value)
+                    || !detail::is_finite(statistics.residual_norm_squared))
+                return result_t{{}, statistics};
+
+            // two-loop recursion for p = -H g, with the initial inverse Hessian scaled by s^T y/y^T y
+            vector p;
+            for (std::size_t i = 0; i < n; ++i)
+                p[i] = -current.gradient[i];
+            std::array<T, history> a{};
+            for (std::size_t k = 0; k < count; ++k) {
+                const std::size_t i = (newest + history - k) % history;
+                a[i] = rho[i]*problem::dot(s[i], p);
+                for (std::size_t j = 0; j < n; ++j)
+                    p[j] -= a[i]*y[i][j];
+            }
+            if (count > 0) {
+                const T scale = problem::dot(s[newest], y[newest])/problem::dot(y[newest], y[newest]);
+                for (std::size_t j = 0; j < n; ++j)
+                    p[j] *= scale;
+            }
+            for (std::size_t k = count; k-- > 0;) {
+                const std::size_t i = (newest + history - k) % history;
+                const T b = rho[i]*problem::dot(y[i], p);
+                for (std::size_t j = 0; j < n; ++j)
+                    p[j] += s[i][j]*(a[i] - b);
+            }
+
+            const T initial_step = count > 0 ? T{1} : T{1}/_norm_of(current.gradient);
+            const auto step = detail::strong_wolfe_search<problem>(
+                initial_guess, current, p, initial_step, _opts, statistics
+            );
+            if (!step) {
+                if (count == 0)
+                    return result_t{{}, statistics};
+                count = 0;  // retry with steepest descent
+                continue;
+            }
+
+            // pairs with non-positive curvature would make the inverse Hessian indefinite and are skipped
+            const auto& [alpha, next] = *step;
+            vector s_new;
+            vector y_new;
+            for (std::size_t j = 0; j < n; ++j) {
+                s_new[j] = alpha*p[j];
+                y_new[j] = next.gradient[j] - current.gradient[j];
+            }
+            if (const T curvature = problem::dot(s_new, y_new); curvature > T{0}) {
+                newest = count > 0 ? (newest + 1) % history : newest;
+                s[newest] = s_new;
+                y[newest] = y_new;
+                rho[newest] = T{1}/curvature;
+                count = std::min(count + 1, history);
+            }
+
+            current = next;
+            statistics.iterations++;
+            statistics.record(problem::dot(current.gradient, current.gradient));
+            detail::notify(_observer, _opts, std::as_const(statistics));
+        }
+
+        statistics.converged = true;
+        return result_t{{std::move(initial_guess)}, statistics};
+    }
+
+ private:
+    template<std::size_t n>
+    static constexpr T _norm_of(const std::array<T, n>& v) noexcept {
+        using std::sqrt;
+        T result{0};
+        for (const auto& entry : v)
+            result += entry*entry;
+        return sqrt(result);
+    }
+
+    solver_options<T> _opts;
+    Observer _observer;
+};
+
+/*!
+ * \brief Minimizes scalar expressions using steepest descent.
+ * \details Uses the same strong-Wolfe line search as `lbfgs`, where the initial trial step of each iteration is
+ *          chosen such that the first-order change of the objective matches that of the previous iteration.
+ *          The results carry statistics on the solver run, and the given observer is invoked with these
+ *          statistics after each iteration.
+ */
+template<typename T = double, typename Observer = no_observer> requires(is_scalar_v<T>)
+struct gradient_descent {
+    using statistics_type = solver_statistics<T>;
+
+    constexpr gradient_descent(solver_options<T>&& opts, Observer observer = {}) noexcept
+    : _opts{std::move(opts)}
+    , _observer{std::move(observer)}
+    {}
+
+    //! Find a minimum of the given scalar expression w.r.t. its variables
+    template<expression E, typename... I>
+    constexpr auto find_minimum_of(const E& objective, bindings<I...>&& initial_guess) const noexcept {
+        return find_minimum_of(objective, traits::variables_of_t<E>{}, std::move(initial_guess));
+    }
+
+    //! Find a minimum of the given scalar expression w.r.t. the given unknowns
+    template<expression E, typename... U, typename... I>
+    constexpr auto find_minimum_of(const E&,
+                                   const type_list<U...>&,
+                                   bindings<I...>&& initial_guess) const noexcept {
+        using problem = decltype(detail::objective_for<T, E>(typename detail::scalar_unknowns<U...>::type{}));
+        using result_t = solver_result<bindings<I...>, statistics_type>;
+        constexpr std::size_t n = problem::n;
+
+        statistics_type statistics;
+        auto current = detail::evaluate<problem>(initial_guess, statistics);
+        statistics.record(problem::dot(current.gradient, current.gradient));
+        const auto threshold_squared = _opts.threshold*_opts.threshold;
+        T previous_change{0};
+        while (!(statistics.residual_norm_squared <= threshold_squared) || !detail::is_finite(current.value)) {
+            if (statistics.iterations >= _opts.max_iterations
+                    || !detail::is_finite(current.value)
+                    || !detail::is_finite(statistics.residual_norm_squared))
+                return result_t{{}, statistics};
+
+            typename problem::vector p;
+            for (std::size_t i = 0; i < n; ++i)
+                p[i] = -current.gradient[i];
+            const T slope = problem::dot(current.gradient, p);
+            const T initial_step = statistics.iterations > 0 ? previous_change/slope : T{1}/_sqrt(-slope);
+            const auto step = detail::strong_wolfe_search<problem>(
+                initial_guess, current, p, initial_step, _opts, statistics
+            );
+            if (!step)
+                return result_t{{}, statistics};
+
+            previous_change = step->first*slope;
+            current = step->second;
+            statistics.iterations++;
+            statistics.record(problem::dot(current.gradient, current.gradient));
+            detail::notify(_observer, _opts, std::as_const(statistics));
+        }
+
+        statistics.converged = true;
+        return result_t{{std::move(initial_guess)}, statistics};
+    }
+
+ private:
+    static constexpr T _sqrt(const T& v) noexcept {
+        using std::sqrt;
+        return sqrt(v);
+    }
+
+    solver_options<T> _opts;
+    Observer _observer;
+};
+
+//! \} group Solvers
+
+}  // namespace xp::solvers
@@ -7,10 +7,11 @@
  */
 #pragma once
 
+#include <cmath>
+#include <cstddef>
 #include <optional>
 #include <type_traits>
-#include <iostream>
-#include <string>
+#include <utility>
 
 #include <xpress/concepts.hpp>
 #include <xpress/bindings.hpp>
@@ -26,22 +27,29 @@ namespace xp::solvers {
 //! \addtogroup Solvers
 //! \{
 
-//! Finds the roots of nonlinear equations using Newton's method
-template<typename T = double> requires(is_scalar_v<T>)
+/*!
+ * \brief Finds the roots of nonlinear equations using Newton's method.
+ * \details The results carry statistics on the solver run (see `solver_statistics`), and the given observer is
+ *          invoked with these statistics after each iteration.
+ */
+template<typename T = double, typename Observer = no_observer> requires(is_scalar_v<T>)
 struct newton {
-    constexpr newton(solver_options<T>&& opts) noexcept
+    using statistics_type = solver_statistics<T>;
+
+    constexpr newton(solver_options<T>&& opts, Observer observer = {}) noexcept
     : _opts{std::move(opts)}
+    , _observer{std::move(observer)}
     {}
 
     template<expression E, typename I>
     constexpr auto find_scalar_root_of(const E& equation, bindings<I>&& initial_guess) const noexcept {
         using symbol_t = typename I::symbol_type;
         using value_t = typename I::value_type;
-        using result_t = std::optional<value_t>;
+        using result_t = solver_result<value_t, statistics_type>;
         auto root = find_root_of(equation, std::move(initial_guess));
         if (root)
-            return result_t{std::move(root).value()[symbol_t{}]};
-        return result_t{};
+            return result_t{{std::move(root).value()[symbol_t{}]}, root.statistics};
+        return result_t{{}, root.statistics};
     }
 
     template<expression E, typename... I>
@@ -53,82 +61,282 @@ struct newton {
             "Bindings to const refs are not supported as initial guess is updated with the solution."
         );
 
-        using result_t = std::optional<bindings<I...>>;
+        using result_t = solver_result<bindings<I...>, statistics_type>;
         using variables = traits::variables_of_t<E>;
+        constexpr std::size_t n = _size_of(variables{});
+        using vector_t = linalg::tensor<T, md_shape<n>>;
+        using matrix_t = linalg::tensor<T, md_shape<n, n>>;
+
+        statistics_type statistics;
+        const auto evaluate_residual = [&] () {
+            statistics.residual_evaluations++;
+            return detail::timed(statistics.residual_time, [&] () {
+                return _as_vector<n>(value_of(equation, initial_guess));
+            });
+        };
+
         const auto gradient = derivatives_of(equation, variables{});
-        auto residual = value_of(equation, initial_guess);
+        vector_t residual = evaluate_residual();
+        T residual_norm_squared = _dot(residual, residual);
+        statistics.record(residual_norm_squared);
 
-        const auto threshold_squared = _opts.threshold*_opts.threshold;
+        matrix_t jacobian;
+        matrix_t inverse_jacobian;
+        T trust_radius = _opts.trust_radius;
+        bool is_stalled = true;
+        bool is_current = false;  // true if the Jacobian has been evaluated at the current unknowns
         std::size_t iteration = 0;
-        auto residual_norm_squared = _squared_norm_of(residual);
-        while (residual_norm_squared > threshold_squared) {
-            if (iteration >= _opts.max_iterations) {
-                if (!std::is_constant_evaluated())
-                    _logger(1) << " -- Newton solver did not converge after " << iteration << " iterations.\n";
-                return result_t{};
+        const auto threshold_squared = _opts.threshold*_opts.threshold;
+        const auto stall_ratio_squared = _opts.stall_ratio*_opts.stall_ratio;
+        while (!(residual_norm_squared <= threshold_squared)) {
+            if (iteration >= _opts.max_iterations)
+                return result_t{{}, statistics};
+
+            if (!is_current && (_opts.jacobian == jacobian_update::exact || is_stalled)) {
+                statistics.jacobian_evaluations++;
+                jacobian = detail::timed(statistics.jacobian_time, [&] () {
+                    return _jacobian_of(gradient.at(initial_guess), variables{});
+                });
+                inverse_jacobian = linalg::inverse_of(jacobian);
+                is_current = true;
+            }
+
+            // the unknowns are updated as x <- x - step, and each trial step reuses its residual evaluation
+            const vector_t unknowns = _unknowns_of(initial_guess, variables{});
+            const vector_t newton_step = _product_of(inverse_jacobian, residual);
+            vector_t new_residual;
+            const auto try_step = [&] (const vector_t& step) {
+                _assign(initial_guess, _difference_of(unknowns, step), variables{});
+                new_residual = evaluate_residual();
+                return _dot(new_residual, new_residual);
+            };
+
+            vector_t step = newton_step;
+            T new_residual_norm_squared;
+            bool is_accepted = true;
+            if (_opts.globalization == globalization_strategy::line_search) {
+                // with the merit function f = |r|^2/2, the Armijo condition reads f(alpha) <= (1 - 2 c alpha) f(0)
+                T alpha{1};
+                const auto is_sufficient = [&] (const T& norm_squared) {
+                    return norm_squared <= (T{1} - T{2}*_opts.sufficient_decrease*alpha)*residual_norm_squared;
+                };
+                new_residual_norm_squared = try_step(step);
+                for (std::size_t k = 0; k < _opts.max_backtracking_steps; ++k) {
+                    if (is_sufficient(new_residual_norm_squared))
+                        break;
+                    alpha /= T{2};
+                    step = _scaled(newton_step, alpha);
+                    new_residual_norm_squared = try_step(step);
+                }
+                is_accepted = is_sufficient(new_residual_norm_squared);
+            } else if (_opts.globalization == globalization_strategy::trust_region) {
+                step = _dogleg_step(jacobian, residual, newton_step, trust_radius);
+                new_residual_norm_squared = try_step(step);
+                const vector_t linearized_residual = _difference_of(residual, _product_of(jacobian, step));
+                const T predicted = residual_norm_squared - _dot(linearized_residual, linearized_residual);
+                const T actual = residual_norm_squared - new_residual_norm_squared;
+                const T ratio = predicted > T{0} ? actual/predicted : T{-1};
+                const T step_norm = _norm_of(step);
+                if (ratio < T{0.25})
+                    trust_radius = T{0.25}*step_norm;
+                else if (ratio > T{0.75} && step_norm >= T{0.99}*trust_radius)
+                    trust_radius *= T{2};
+                is_accepted = ratio > T{1e-4};
+            } else {
+                new_residual_norm_squared = try_step(step);
             }
 
-            residual = value_of(equation, initial_guess);
-            residual_norm_squared = _squared_norm_of(residual);
-            _update(initial_guess, residual, gradient.at(initial_guess), variables{});
             ++iteration;
-            if (!std::is_constant_evaluated())
-                _logger(1) << " -- finished iteration " << iteration << "; residual = " << residual_norm_squared << "\n";
+            if (is_accepted) {
+                is_current = false;
+                if (_opts.jacobian == jacobian_update::broyden)
+                    _broyden_update(jacobian, inverse_jacobian, step, _difference_of(new_residual, residual));
+                is_stalled = !(new_residual_norm_squared <= stall_ratio_squared*residual_norm_squared);
+                residual = new_residual;
+                residual_norm_squared = new_residual_norm_squared;
+            } else {
+                _assign(initial_guess, unknowns, variables{});
+                // backtracking along the step of a current Jacobian fails again in the next iteration
+                if (is_current && _opts.globalization == globalization_strategy::line_search) {
+                    statistics.iterations = iteration;
+                    return result_t{{}, statistics};
+                }
+                is_stalled = true;
+            }
+
+            statistics.iterations = iteration;
+            statistics.record(residual_norm_squared);
+            detail::notify(_observer, _opts, std::as_const(statistics));
         }
 
-        return result_t{std::move(initial_guess)};
+        statistics.converged = true;
+        return result_t{{std::move(initial_guess)}, statistics};
     }
 
  private:
-    constexpr progress_logger _logger(unsigned int verbosity_level) const noexcept {
-        return verbosity_level <= _opts.verbosity_level
-            ? progress_logger::active(std::cout)
-            : progress_logger::suppressed(std::cout);
+    template<typename... V>
+    static constexpr std::size_t _size_of(const type_list<V...>&) noexcept {
+        return sizeof...(V);
+    }
+
+    template<std::size_t n, typename R>
+    static constexpr auto _as_vector(const R& residual) noexcept {
+        linalg::tensor<T, md_shape<n>> result;
+        if constexpr (is_scalar_v<R>) {
+            static_assert(n == 1, "Number of unknowns does not match the number of equations.");
+            result[0] = static_cast<T>(residual);
+        } else {
+            static_assert(shape_of_t<R>::count == n, "Number of unknowns does not match the number of equations.");
+            visit_indices_in(shape_of_t<R>{}, [&] <std::size_t i> (const md_index<i>& idx) {
+                result[i] = static_cast<T>(access<R>::at(idx, residual));
+            });
+        }
+        return result;
     }
 
-    template<typename... S, typename R, typename G, typename V>
-        requires(is_scalar_v<R>)
-    constexpr void _update(bindings<S...>& solution,
-                           const R& residual,
-                           const G& gradient,
-                           const type_list<V>&) const noexcept {
-        solution[V{}] -= residual/gradient[V{}];
+    // Jacobian with entries J(i, j) = dr_i/dx_j
+    template<typename G, typename... V>
+    static constexpr auto _jacobian_of(const G& gradient, const type_list<V...>&) noexcept {
+        constexpr std::size_t n = sizeof...(V);
+        linalg::tensor<T, md_shape<n, n>> jacobian;
+        std::size_t j = 0;
+        const auto set_column = [&] (const linalg::tensor<T, md_shape<n>>& column) {
+            for (std::size_t i = 0; i < n; ++i)
+                jacobian[i, j] = column[i];
+            ++j;
+        };
+        (..., set_column(_as_vector<n>(gradient[V{}])));
+        return jacobian;
     }
 
-    template<typename... S, typename R, typename G, typename V1, typename V2>
-        requires(tensorial<R>)
-    constexpr void _update(bindings<S...>& solution,
-                           const R& residual,
-                           const G& gradient,
-                           const type_list<V1, V2>&) const noexcept {
-        static_assert(
-            shape_of_t<R>{}.first() == 2,
-            "Newton update currently only implemented for scalar equations or 2d equation systems."
-        );
-        const linalg::tensor jacobian{shape<2, 2>,
-            gradient[V1{}][at<0>()], gradient[V2{}][at<0>()],
-            gradient[V1{}][at<1>()], gradient[V2{}][at<1>()]
+    template<typename... S, typename... V>
+    static constexpr auto _unknowns_of(const bindings<S...>& solution, const type_list<V...>&) noexcept {
+        return linalg::tensor<T, md_shape<sizeof...(V)>>{
+            md_shape<sizeof...(V)>{}, static_cast<T>(solution[V{}])...
         };
-        const auto jacobian_inverse = linalg::tensor{shape<2, 2>,
-            jacobian[at<1, 1>()], -jacobian[at<0, 1>()],
-            -jacobian[at<1, 0>()], jacobian[at<0, 0>()]
-        }*(1.0/linalg::determinant_of(jacobian));
-        const auto update = mat_mul(jacobian_inverse, residual);
-        solution[V1{}] -= update[at<0>()];
-        solution[V2{}] -= update[at<1>()];
     }
 
-    template<typename R> requires(is_scalar_v<R>)
-    constexpr auto _squared_norm_of(const R& residual) const noexcept {
-        return residual*residual;
+    template<typename... S, typename U, typename... V>
+    static constexpr void _assign(bindings<S...>& solution, const U& values, const type_list<V...>&) noexcept {
+        std::size_t j = 0;
+        (..., (solution[V{}] = values[j++]));
     }
 
-    template<typename R> requires(tensorial<R>)
-    constexpr auto _squared_norm_of(const R& residual) const noexcept {
-        return operators::traits::multiplication_of<R, R>{}(residual, residual);
+    template<std::size_t n>
+    static constexpr auto _product_of(const linalg::tensor<T, md_shape<n, n>>& matrix,
+                                      const linalg::tensor<T, md_shape<n>>& vector) noexcept {
+        linalg::tensor<T, md_shape<n>> result{T{0}};
+        for (std::size_t i = 0; i < n; ++i)
+            for (std::size_t j = 0; j < n; ++j)
+                result[i] += matrix[i, j]*vector[j];
+        return result;
+    }
+
+    template<std::size_t n>
+    static constexpr auto _transposed_product_of(const linalg::tensor<T, md_shape<n, n>>& matrix,
+                                                 const linalg::tensor<T, md_shape<n>>& vector) noexcept {
+        linalg::tensor<T, md_shape<n>> result{T{0}};
+        for (std::size_t i = 0; i < n; ++i)
+            for (std::size_t j = 0; j < n; ++j)
+                result[j] += matrix[i, j]*vector[i];
+        return result;
+    }
+
+    template<std::size_t n>
+    static constexpr auto _difference_of(const linalg::tensor<T, md_shape<n>>& a,
+                                         const linalg::tensor<T, md_shape<n>>& b) noexcept {
+        linalg::tensor<T, md_shape<n>> result;
+        for (std::size_t i = 0; i < n; ++i)
+            result[i] = a[i] - b[i];
+        return result;
+    }
+
+    template<std::size_t n>
+    static constexpr auto _scaled(const linalg::tensor<T, md_shape<n>>& v, const T& factor) noexcept {
+        linalg::tensor<T, md_shape<n>> result;
+        for (std::size_t i = 0; i < n; ++i)
+            result[i] = v[i]*factor;
+        return result;
+    }
+
+    template<std::size_t n>
+    static constexpr T _dot(const linalg::tensor<T, md_shape<n>>& a, const linalg::tensor<T, md_shape<n>>& b) noexcept {
+        T result{0};
+        for (std::size_t i = 0; i < n; ++i)
+            result += a[i]*b[i];
+        return result;
+    }
+
+    template<std::size_t n>
+    static constexpr T _norm_of(const linalg::tensor<T, md_shape<n>>& v) noexcept {
+        using std::sqrt;
+        return sqrt(_dot(v, v));
+    }
+
+    // "good" Broyden update J += (y - J s) s^T / (s^T s) of the Jacobian and the corresponding Sherman-Morrison
+    // update H += (s - H y) s^T H / (s^T H y) of its inverse, where s = -step is the change of the unknowns
+    template<std::size_t n>
+    static constexpr void _broyden_update(linalg::tensor<T, md_shape<n, n>>& jacobian,
+                                          linalg::tensor<T, md_shape<n, n>>& inverse_jacobian,
+                                          const linalg::tensor<T, md_shape<n>>& step,
+                                          const linalg::tensor<T, md_shape<n>>& residual_change) noexcept {
+        const T step_norm_squared = _dot(step, step);
+        if (step_norm_squared == T{0})
+            return;
+        const auto change = _scaled(step, T{-1});
+        const auto defect = _difference_of(residual_change, _product_of(jacobian, change));
+        for (std::size_t i = 0; i < n; ++i)
+            for (std::size_t j = 0; j < n; ++j)
+                jacobian[i, j] += defect[i]*change[j]/step_norm_squared;
+
+        const auto hy = _product_of(inverse_jacobian, residual_change);
+        const T denominator = _dot(change, hy);
+        if (denominator == T{0}) {
+            inverse_jacobian = linalg::inverse_of(jacobian);
+            return;
+        }
+        const auto sh = _transposed_product_of(inverse_jacobian, change);
+        const auto correction = _difference_of(change, hy);
+        for (std::size_t i = 0; i < n; ++i)
+            for (std::size_t j = 0; j < n; ++j)
+                inverse_jacobian[i, j] += correction[i]*sh[j]/denominator;
+    }
+
+    // step (to be subtracted) along the dogleg path between the Cauchy point and the Newton step
+    template<std::size_t n>
+    static constexpr auto _dogleg_step(const linalg::tensor<T, md_shape<n, n>>& jacobian,
+                                       const linalg::tensor<T, md_shape<n>>& residual,
+                                       const linalg::tensor<T, md_shape<n>>& newton_step,
+                                       const T& radius) noexcept {
+        using std::sqrt;
+        if (_norm_of(newton_step) <= radius)
+            return newton_step;
+
+        const auto gradient = _transposed_product_of(jacobian, residual);
+        const auto jacobian_gradient = _product_of(jacobian, gradient);
+        const T gradient_norm_squared = _dot(gradient, gradient);
+        const T curvature = _dot(jacobian_gradient, jacobian_gradient);
+        if (gradient_norm_squared == T{0} || curvature == T{0})
+            return _scaled(newton_step, radius/_norm_of(newton_step));
+
+        const auto cauchy_step = _scaled(gradient, gradient_norm_squared/curvature);
+        if (_norm_of(cauchy_step) >= radius)
+            return _scaled(gradient, radius/sqrt(gradient_norm_squared));
+
+        // find tau in [0, 1] such that |cauchy + tau*(newton - cauchy)| = radius
+        const auto direction = _difference_of(newton_step, cauchy_step);
+        const T a = _dot(direction, direction);
+        const T b = T{2}*_dot(cauchy_step, direction);
+        const T c = _dot(cauchy_step, cauchy_step) - radius*radius;
+        const T tau = (-b + sqrt(b*b - T{4}*a*c))/(T{2}*a);
+        auto result = cauchy_step;
+        for (std::size_t i = 0; i < n; ++i)
+            result[i] += tau*direction[i];
+        return result;
     }
 
     solver_options<T> _opts;
+    Observer _observer;
 };
 
 //! \} group Solvers
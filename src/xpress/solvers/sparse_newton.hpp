@@ -0,0 +1,500 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Solvers
+ * \brief Newton solver for larger systems of nonlinear equations with sparse Jacobians.
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <xpress/concepts.hpp>
+#include <xpress/bindings.hpp>
+#include <xpress/expressions.hpp>
+#include <xpress/traits.hpp>
+#include <xpress/linalg.hpp>
+#include <xpress/tensor.hpp>
+
+#include "common.hpp"
+
+
+namespace xp::solvers {
+
+//! \addtogroup Solvers
+//! \{
+
+#ifndef DOXYGEN
+namespace detail {
+
+    template<std::size_t... s>
+    constexpr std::size_t index_in_dimension(const md_shape<s...>&, std::size_t flat, std::size_t dim) noexcept {
+        constexpr std::array<std::size_t, sizeof...(s)> extents{s...};
+        std::size_t stride = 1;
+        for (std::size_t d = dim + 1; d < extents.size(); ++d)
+            stride *= extents[d];
+        return (flat/stride)%extents[dim];
+    }
+
+    // the scalar unknowns represented by a symbol, i.e. the symbol itself or the entries of a tensor
+    template<typename S>
+    struct scalar_unknowns_of : std::type_identity<type_list<S>> {};
+    template<typename shape, typename T, auto _>
+    struct scalar_unknowns_of<tensor<shape, T, _>> {
+        template<std::size_t k, std::size_t... d>
+        static constexpr auto _entry(std::index_sequence<d...>) noexcept {
+            return tensor_var<tensor<shape, T, _>, index_in_dimension(shape{}, k, d)...>{};
+        }
+
+        template<std::size_t... k>
+        static constexpr auto _entries(std::index_sequence<k...>) noexcept {
+            return type_list<decltype(_entry<k>(std::make_index_sequence<shape::dimensions>{}))...>{};
+        }
+
+        using type = decltype(_entries(std::make_index_sequence<shape::count>{}));
+    };
+
+    template<typename... S>
+    struct scalar_unknowns : std::type_identity<type_list<>> {};
+    template<typename S, typename... Ss>
+    struct scalar_unknowns<S, Ss...>
+    : std::type_identity<merged_t<typename scalar_unknowns_of<S>::type, typename scalar_unknowns<Ss...>::type>> {};
+
+    template<typename U>
+    struct symbols_of_unknown : std::type_identity<type_list<U>> {};
+    template<typename T, std::size_t... i>
+    struct symbols_of_unknown<tensor_var<T, i...>> : std::type_identity<type_list<tensor_var<T, i...>, T>> {};
+
+    template<typename E, typename U>
+    inline constexpr bool appears_in = [] <typename... S> (const type_list<S...>&) {
+        return (is_any_of_v<S, traits::unique_leaf_nodes_of_t<E>> || ...);
+    } (typename symbols_of_unknown<U>::type{});
+
+    // expression of the derivative of residual E w.r.t. unknown U, which is value<0> if U does not appear in E
+    template<typename E, typename U>
+    struct jacobian_entry : std::type_identity<value<0>> {};
+    template<typename E, typename U> requires(appears_in<E, U>)
+    struct jacobian_entry<E, U> : std::type_identity<decltype(xp::detail::differentiate<E>(type_list<U>{}))> {};
+    template<typename E, typename U>
+    using jacobian_entry_t = typename jacobian_entry<E, U>::type;
+
+    // pattern of the derivatives of residual R w.r.t. the unknowns U that are not structurally zero
+    template<typename R, typename... U>
+    inline constexpr std::array<bool, sizeof...(U)> jacobian_row_pattern{appears_in<R, U>...};
+
+    // row-major pattern of the Jacobian of the residuals E, built from the unknowns each residual contains
+    template<typename E, typename... U, std::size_t... r>
+    constexpr auto jacobian_pattern(std::index_sequence<r...>) noexcept {
+        constexpr std::size_t n = sizeof...(U);
+        constexpr std::array<std::array<bool, n>, sizeof...(r)> rows{
+            jacobian_row_pattern<std::remove_cvref_t<decltype(E{}[md_ic<r>])>, U...>...
+        };
+        std::array<bool, sizeof...(r)*n> pattern{};
+        for (std::size_t i = 0; i < rows.size(); ++i)
+            for (std::size_t j = 0; j < n; ++j)
+                pattern[i*n + j] = rows[i][j];
+        return pattern;
+    }
+
+    // reference to the value of a scalar unknown in the given bindings
+    template<typename B, typename U>
+    constexpr decltype(auto) value_of_unknown(B&& solution, const U&) noexcept {
+        return std::forward<B>(solution)[U{}];
+    }
+
+    template<typename B, typename T, std::size_t... i>
+    constexpr decltype(auto) value_of_unknown(B&& solution, const tensor_var<T, i...>&) noexcept {
+        using tensor_type = std::remove_cvref_t<decltype(solution[T{}])>;
+        return access<tensor_type>::at(md_index<i...>{}, std::forward<B>(solution)[T{}]);
+    }
+
+    /*!
+     * \brief Compile-time plan for the sparse LU factorization of a Jacobian with the given non-zero pattern.
+     * \details The equations are first matched to the unknowns such that the permuted matrix has a zero-free
+     *          diagonal. Then, a minimum-degree ordering of the symmetrized pattern is used to reduce the fill-in,
+     *          and the symbolic factorization yields the pattern of the factors in compressed row storage. The
+     *          numeric factorization is flattened into a table of eliminations, each followed by the updates of
+     *          the entries it affects. Pivots are chosen statically, i.e. the Jacobian is assumed to not become
+     *          (numerically) singular on the permuted diagonal.
+     */
+    template<std::size_t n, auto pattern>
+    struct sparse_lu_plan {
+        static constexpr std::size_t none = std::numeric_limits<std::size_t>::max();
+
+     private:
+        static constexpr bool _augment(std::size_t col,
+                                       std::array<std::size_t, n>& col_of_row,
+                                       std::array<bool, n>& visited) noexcept {
+            for (std::size_t r = 0; r < n; ++r)
+                if (pattern[r*n + col] && !visited[r]) {
+                    visited[r] = true;
+                    if (col_of_row[r] == none || _augment(col_of_row[r], col_of_row, visited)) {
+                        col_of_row[r] = col;
+                        return true;
+                    }
+                }
+            return false;
+        }
+
+        static constexpr auto _matching() noexcept {
+            // keep the equations with non-zero diagonal entries in place, and augment the matching from there
+            std::array<std::size_t, n> col_of_row;
+            std::array<bool, n> is_matched{};
+            for (std::size_t r = 0; r < n; ++r) {
+                col_of_row[r] = pattern[r*n + r] ? r : none;
+                is_matched[r] = pattern[r*n + r];
+            }
+            for (std::size_t c = 0; c < n; ++c)
+                if (!is_matched[c]) {
+                    std::array<bool, n> visited{};
+                    _augment(c, col_of_row, visited);
+                }
+            std::array<std::size_t, n> row_of_col;
+            row_of_col.fill(none);
+            for (std::size_t r = 0; r < n; ++r)
+                if (col_of_row[r] != none)
+                    row_of_col[col_of_row[r]] = r;
+            return row_of_col;
+        }
+
+     public:
+        //! the equation (row) matched to each unknown (column)
+        static constexpr std::array<std::size_t, n> row_of_column = _matching();
+        static constexpr bool is_structurally_regular = std::ranges::find(row_of_column, none) == row_of_column.end();
+
+     private:
+        // the matching, or the identity for structurally singular patterns (for which no factorization exists)
+        static constexpr std::array<std::size_t, n> _rows = [] () {
+            std::array<std::size_t, n> rows = row_of_column;
+            if (!is_structurally_regular)
+                for (std::size_t i = 0; i < n; ++i)
+                    rows[i] = i;
+            return rows;
+        } ();
+
+     public:
+        //! elimination order of the unknowns (minimum degree on the symmetrized, matched pattern)
+        static constexpr std::array<std::size_t, n> order = [] () {
+            std::array<bool, n*n> adjacent{};
+            std::array<std::size_t, n> degree{};
+            const auto connect = [&] (std::size_t a, std::size_t b) {
+                if (a != b && !adjacent[a*n + b]) {
+                    adjacent[a*n + b] = adjacent[b*n + a] = true;
+                    ++degree[a]; ++degree[b];
+                }
+            };
+            for (std::size_t i = 0; i < n; ++i)
+                for (std::size_t j = 0; j < n; ++j)
+                    if (pattern[_rows[i]*n + j])
+                        connect(i, j);
+
+            std::array<std::size_t, n> order{};
+            std::array<bool, n> eliminated{};
+            for (std::size_t p = 0; p < n; ++p) {
+                std::size_t v = none;
+                for (std::size_t i = 0; i < n; ++i)
+                    if (!eliminated[i] && (v == none || degree[i] < degree[v]))
+                        v = i;
+                order[p] = v;
+                eliminated[v] = true;
+
+                // the remaining neighbors of the eliminated unknown become a clique
+                std::array<std::size_t, n> neighbors{};
+                std::size_t neighbor_count = 0;
+                for (std::size_t a = 0; a < n; ++a)
+                    if (adjacent[v*n + a]) {
+                        adjacent[v*n + a] = adjacent[a*n + v] = false;
+                        --degree[a];
+                        neighbors[neighbor_count++] = a;
+                    }
+                for (std::size_t a = 0; a < neighbor_count; ++a)
+                    for (std::size_t b = a + 1; b < neighbor_count; ++b)
+                        connect(neighbors[a], neighbors[b]);
+            }
+            return order;
+        } ();
+
+     private:
+        // pattern of the permuted matrix, with position (p, q) referring to unknowns order[p] and order[q]
+        static constexpr std::array<bool, n*n> _permuted = [] () {
+            std::array<bool, n*n> permuted{};
+            for (std::size_t p = 0; p < n; ++p)
+                for (std::size_t q = 0; q < n; ++q)
+                    permuted[p*n + q] = p == q || pattern[_rows[order[p]]*n + order[q]];
+            return permuted;
+        } ();
+
+        static constexpr std::array<bool, n*n> _filled = [] () {
+            auto filled = _permuted;
+            for (std::size_t k = 0; k < n; ++k)
+                for (std::size_t i = k + 1; i < n; ++i)
+                    if (filled[i*n + k])
+                        for (std::size_t j = k + 1; j < n; ++j)
+                            if (filled[k*n + j])
+                                filled[i*n + j] = true;
+            return filled;
+        } ();
+
+     public:
+        //! number of stored entries of the factors
+        static constexpr std::size_t nonzeros = std::ranges::count(_filled, true);
+
+        //! compressed row storage of the factors
+        static constexpr std::array<std::size_t, n + 1> row_begin = [] () {
+            std::array<std::size_t, n + 1> begin{};
+            for (std::size_t i = 0; i < n; ++i)
+                begin[i+1] = begin[i] + std::ranges::count(_filled.begin() + i*n, _filled.begin() + (i+1)*n, true);
+            return begin;
+        } ();
+
+        static constexpr std::array<std::size_t, nonzeros> columns = [] () {
+            std::array<std::size_t, nonzeros> columns{};
+            for (std::size_t i = 0, s = 0; i < n; ++i)
+                for (std::size_t j = 0; j < n; ++j)
+                    if (_filled[i*n + j])
+                        columns[s++] = j;
+            return columns;
+        } ();
+
+        //! position of the entry (p, q) of the permuted matrix in the storage of the factors
+        static constexpr std::size_t slot(std::size_t p, std::size_t q) noexcept {
+            for (std::size_t s = row_begin[p]; s < row_begin[p+1]; ++s)
+                if (columns[s] == q)
+                    return s;
+            return none;
+        }
+
+        static constexpr std::array<std::size_t, n> diagonal = [] () {
+            std::array<std::size_t, n> diagonal{};
+            for (std::size_t i = 0; i < n; ++i)
+                diagonal[i] = slot(i, i);
+            return diagonal;
+        } ();
+
+        //! division of an entry of L by its pivot, followed by the updates [updates_begin, updates_end)
+        struct elimination { std::size_t entry; std::size_t pivot; std::size_t updates_begin, updates_end; };
+        struct update { std::size_t target; std::size_t source; };
+
+     private:
+        static constexpr std::size_t _count_of_upper(std::size_t k) noexcept {
+            return row_begin[k+1] - diagonal[k] - 1;
+        }
+
+        static constexpr std::size_t _elimination_count = [] () {
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < n; ++i)
+                count += diagonal[i] - row_begin[i];
+            return count;
+        } ();
+
+        static constexpr std::size_t _update_count = [] () {
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < n; ++i)
+                for (std::size_t s = row_begin[i]; s < diagonal[i]; ++s)
+                    count += _count_of_upper(columns[s]);
+            return count;
+        } ();
+
+     public:
+        //! the flattened numeric factorization, eliminating row by row (IKJ variant of Gaussian elimination)
+        static constexpr auto factorization = [] () {
+            std::pair<std::array<elimination, _elimination_count>, std::array<update, _update_count>> steps{};
+            std::size_t e = 0, u = 0;
+            for (std::size_t i = 0; i < n; ++i)
+                for (std::size_t s = row_begin[i]; s < diagonal[i]; ++s) {
+                    const std::size_t k = columns[s];
+                    steps.first[e] = {s, diagonal[k], u, u + _count_of_upper(k)};
+                    for (std::size_t t = diagonal[k] + 1; t < row_begin[k+1]; ++t)
+                        steps.second[u++] = {slot(i, columns[t]), t};
+                    ++e;
+                }
+            return steps;
+        } ();
+
+        //! position in the permuted matrix of each equation (row) and unknown (column) of the original one
+        static constexpr auto positions = [] () {
+            std::pair<std::array<std::size_t, n>, std::array<std::size_t, n>> positions{};
+            for (std::size_t p = 0; p < n; ++p) {
+                positions.first[_rows[order[p]]] = p;
+                positions.second[order[p]] = p;
+            }
+            return positions;
+        } ();
+
+        //! number of non-zero entries of the Jacobian
+        static constexpr std::size_t jacobian_nonzeros = std::ranges::count(pattern, true);
+
+        //! flat indices (row*n + column) of the non-zero Jacobian entries
+        static constexpr auto jacobian_entries = [] () {
+            std::array<std::size_t, jacobian_nonzeros> entries{};
+            for (std::size_t k = 0, i = 0; k < n*n; ++k)
+                if (pattern[k])
+                    entries[i++] = k;
+            return entries;
+        } ();
+
+        //! storage positions of the non-zero Jacobian entries in the factors
+        static constexpr auto jacobian_slots = [] () {
+            std::array<std::size_t, jacobian_nonzeros> slots{};
+            for (std::size_t k = 0; k < jacobian_nonzeros; ++k)
+                slots[k] = slot(positions.first[jacobian_entries[k]/n], positions.second[jacobian_entries[k]%n]);
+            return slots;
+        } ();
+    };
+
+}  // namespace detail
+#endif  // DOXYGEN
+
+/*!
+ * \brief Finds the roots of systems of nonlinear equations with sparse Jacobians using Newton's method.
+ * \details The system is given as vector expression whose entries are the residuals of the equations. The
+ *          sparsity pattern of the Jacobian is deduced at compile time from the unknowns that each equation contains,
+ *          from which a fill-reducing ordering and the symbolic LU factorization are computed (also at
+ *          compile time). Each iteration then only evaluates the non-zero Jacobian entries and carries out the
+ *          sparse numeric factorization. The unknowns may be scalar variables or tensors, whose entries then
+ *          each represent an unknown. As for `newton`, the results carry statistics on the solver run, and the
+ *          given observer is invoked with these statistics after each iteration.
+ */
+template<typename T = double, typename Observer = no_observer> requires(is_scalar_v<T>)
+struct sparse_newton {
+    using statistics_type = solver_statistics<T>;
+
+    constexpr sparse_newton(solver_options<T>&& opts, Observer observer = {}) noexcept
+    : _opts{std::move(opts)}
+    , _observer{std::move(observer)}
+    {}
+
+    //! Find the root of the given system of equations w.r.t. its variables
+    template<tensorial_expression E, typename... I>
+    constexpr auto find_root_of(const E& equations, bindings<I...>&& initial_guess) const noexcept {
+        return find_root_of(equations, traits::variables_of_t<E>{}, std::move(initial_guess));
+    }
+
+    //! Find the root of the given system of equations w.r.t. the given unknowns
+    template<tensorial_expression E, typename... U, typename... I>
+    constexpr auto find_root_of(const E& equations,
+                                const type_list<U...>&,
+                                bindings<I...>&& initial_guess) const noexcept {
+        static_assert(shape_of_t<E>::dimensions == 1, "Sparse Newton solver expects a vector of equations.");
+        using unknowns = typename detail::scalar_unknowns<U...>::type;
+        using plan = decltype(_plan_for(equations, unknowns{}));
+        static_assert(plan::is_structurally_regular, "The Jacobian of the given system is structurally singular.");
+
+        using result_t = solver_result<bindings<I...>, statistics_type>;
+        statistics_type statistics;
+        const auto evaluate_residual = [&] () {
+            statistics.residual_evaluations++;
+            return detail::timed(statistics.residual_time, [&] () {
+                return value_of(equations, initial_guess);
+            });
+        };
+
+        const auto threshold_squared = _opts.threshold*_opts.threshold;
+        auto residual = evaluate_residual();
+        T residual_norm_squared = _squared_norm_of(residual);
+        statistics.record(residual_norm_squared);
+        while (!(residual_norm_squared <= threshold_squared)) {
+            if (statistics.iterations >= _opts.max_iterations || !detail::is_finite(residual_norm_squared))
+                return result_t{{}, statistics};
+
+            statistics.jacobian_evaluations++;
+            const auto jacobian = detail::timed(statistics.jacobian_time, [&] () {
+                return _jacobian_of<plan, E>(initial_guess, unknowns{});
+            });
+            _update<plan>(initial_guess, jacobian, residual, unknowns{});
+            residual = evaluate_residual();
+            residual_norm_squared = _squared_norm_of(residual);
+            statistics.iterations++;
+            statistics.record(residual_norm_squared);
+            detail::notify(_observer, _opts, std::as_const(statistics));
+        }
+
+        statistics.converged = true;
+        return result_t{{std::move(initial_guess)}, statistics};
+    }
+
+ private:
+    template<typename E, typename... U>
+    static constexpr auto _plan_for(const E&, const type_list<U...>&) noexcept {
+        constexpr std::size_t n = shape_of_t<E>::count;
+        static_assert(sizeof...(U) == n, "Number of unknowns does not match the number of equations.");
+        constexpr auto pattern = detail::jacobian_pattern<E, U...>(std::make_index_sequence<n>{});
+        return detail::sparse_lu_plan<n, pattern>{};
+    }
+
+    // expression of the Jacobian entry with flat index k = row*n + column
+    template<typename E, std::size_t k, typename... U>
+    using _jacobian_entry_t = detail::jacobian_entry_t<
+        std::remove_cvref_t<decltype(E{}[md_ic<k/sizeof...(U)>])>,
+        std::tuple_element_t<k%sizeof...(U), std::tuple<U...>>
+    >;
+
+    // factorizes the given Jacobian entries in place and updates the solution with the Newton step
+    template<typename plan, typename... S, typename R, typename... U>
+    constexpr void _update(bindings<S...>& solution,
+                           std::array<T, plan::nonzeros> lu,
+                           const R& residual,
+                           const type_list<U...>&) const noexcept {
+        constexpr std::size_t n = sizeof...(U);
+        for (const auto& e : plan::factorization.first) {
+            lu[e.entry] /= lu[e.pivot];
+            for (std::size_t u = e.updates_begin; u < e.updates_end; ++u)
+                lu[plan::factorization.second[u].target] -= lu[e.entry]*lu[plan::factorization.second[u].source];
+        }
+
+        std::array<T, n> x{};
+        visit_indices_in(shape<n>, [&] <std::size_t i> (const md_index<i>& idx) {
+            x[plan::positions.first[i]] = static_cast<T>(access<R>::at(idx, residual));
+        });
+        for (std::size_t i = 0; i < n; ++i)
+            for (std::size_t s = plan::row_begin[i]; s < plan::diagonal[i]; ++s)
+                x[i] -= lu[s]*x[plan::columns[s]];
+        for (std::size_t i = n; i-- > 0;) {
+            for (std::size_t s = plan::diagonal[i] + 1; s < plan::row_begin[i+1]; ++s)
+                x[i] -= lu[s]*x[plan::columns[s]];
+            x[i] /= lu[plan::diagonal[i]];
+        }
+
+        [&] <std::size_t... j> (std::index_sequence<j...>) {
+            (..., (detail::value_of_unknown(solution, U{}) -= x[plan::positions.second[j]]));
+        } (std::make_index_sequence<n>{});
+    }
+
+    // the non-zero Jacobian entries, stored in the slots of the LU factors
+    template<typename plan, typename E, typename... S, typename... U>
+    constexpr auto _jacobian_of(const bindings<S...>& solution, const type_list<U...>&) const noexcept {
+        std::array<T, plan::nonzeros> lu{};
+        [&] <std::size_t... k> (std::index_sequence<k...>) {
+            (..., (lu[plan::jacobian_slots[k]] = static_cast<T>(
+                value_of(_jacobian_entry_t<E, plan::jacobian_entries[k], U...>{}, solution)
+            )));
+        } (std::make_index_sequence<plan::jacobian_slots.size()>{});
+        return lu;
+    }
+
+    template<typename R> requires(is_scalar_v<R>)
+    constexpr auto _squared_norm_of(const R& residual) const noexcept {
+        return residual*residual;
+    }
+
+    template<typename R> requires(tensorial<R>)
+    constexpr auto _squared_norm_of(const R& residual) const noexcept {
+        T result{0};
+        visit_indices_in(shape_of_t<R>{}, [&] (const auto& idx) {
+            result += access<R>::at(idx, residual)*access<R>::at(idx, residual);
+        });
+        return result;
+    }
+
+    solver_options<T> _opts;
+    Observer _observer;
+};
+
+//! \} group Solvers
+
+}  // namespace xp::solvers
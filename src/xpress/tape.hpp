@@ -0,0 +1,251 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Expressions
+ * \brief Evaluation of scalar expressions via a straight-line instruction tape.
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+#include "utils.hpp"
+#include "traits.hpp"
+#include "bindings.hpp"
+#include "expressions.hpp"
+#include "operators.hpp"
+
+
+namespace xp {
+
+//! \addtogroup Expressions
+//! \{
+
+//! Instruction set of tapes and runtime programs
+namespace bytecode {
+
+//! Operation codes of the instructions on a tape
+enum class opcode : unsigned char {
+    add,
+    subtract,
+    multiply,
+    divide,
+    pow,
+    log
+};
+
+//! Instruction on a tape, writing the result of an operation on one or two registers into the output register
+struct instruction {
+    opcode code;
+    std::size_t lhs;
+    std::size_t rhs;
+    std::size_t out;
+};
+
+//! Execute the given instruction on the given registers
+template<typename R>
+inline constexpr void execute(const instruction& i, R& r) noexcept {
+    switch (i.code) {
+        case opcode::add:      r[i.out] = operators::add{}(r[i.lhs], r[i.rhs]); break;
+        case opcode::subtract: r[i.out] = operators::subtract{}(r[i.lhs], r[i.rhs]); break;
+        case opcode::multiply: r[i.out] = operators::multiply{}(r[i.lhs], r[i.rhs]); break;
+        case opcode::divide:   r[i.out] = operators::divide{}(r[i.lhs], r[i.rhs]); break;
+        case opcode::pow:      r[i.out] = operators::pow{}(r[i.lhs], r[i.rhs]); break;
+        case opcode::log:      r[i.out] = operators::log{}(r[i.lhs]); break;
+    }
+}
+
+}  // namespace bytecode
+
+namespace traits {
+
+//! Trait to register the operation code with which an operator is represented on tapes
+template<typename op>
+struct tape_opcode;
+
+template<> struct tape_opcode<operators::add>
+    : std::integral_constant<bytecode::opcode, bytecode::opcode::add> {};
+template<> struct tape_opcode<operators::subtract>
+    : std::integral_constant<bytecode::opcode, bytecode::opcode::subtract> {};
+template<> struct tape_opcode<operators::multiply>
+    : std::integral_constant<bytecode::opcode, bytecode::opcode::multiply> {};
+template<> struct tape_opcode<operators::divide>
+    : std::integral_constant<bytecode::opcode, bytecode::opcode::divide> {};
+template<> struct tape_opcode<operators::pow>
+    : std::integral_constant<bytecode::opcode, bytecode::opcode::pow> {};
+template<> struct tape_opcode<operators::log>
+    : std::integral_constant<bytecode::opcode, bytecode::opcode::log> {};
+
+}  // namespace traits
+
+
+#ifndef DOXYGEN
+namespace detail {
+
+    template<typename T, typename R = type_list<>>
+    struct reversed;
+    template<typename... R>
+    struct reversed<type_list<>, type_list<R...>> : std::type_identity<type_list<R...>> {};
+    template<typename T0, typename... T, typename... R>
+    struct reversed<type_list<T0, T...>, type_list<R...>> : reversed<type_list<T...>, type_list<T0, R...>> {};
+
+    // map from the (unique) nodes of a list to their positions, instantiated once per list
+    template<std::size_t i, typename N>
+    struct indexed_node {};
+    template<typename T, typename = std::make_index_sequence<T::size>>
+    struct node_positions;
+    template<typename... N, std::size_t... i>
+    struct node_positions<type_list<N...>, std::index_sequence<i...>> : indexed_node<i, N>... {};
+
+    template<typename N, std::size_t i>
+    constexpr std::size_t position_of(const indexed_node<i, N>*) noexcept { return i; }
+    template<typename N>
+    constexpr std::size_t position_of(const void*) noexcept { return std::size_t(-1); }
+
+    template<typename T, typename... N>
+    constexpr std::size_t register_of(const type_list<N...>&) noexcept {
+        constexpr std::size_t i = position_of<T>(static_cast<const node_positions<type_list<N...>>*>(nullptr));
+        if constexpr (i < sizeof...(N))
+            return i;
+        else {
+            // T is not among the nodes, but may be equal to one of them (e.g. a permutation of a commutative op)
+            constexpr std::array<bool, sizeof...(N)> is_equal{traits::is_equal_node_v<T, N>...};
+            for (std::size_t j = 0; j < is_equal.size(); ++j)
+                if (is_equal[j])
+                    return j;
+            return sizeof...(N);
+        }
+    }
+
+    template<typename B, typename T>
+    struct common_value_type;
+    template<typename B, typename... T>
+    struct common_value_type<B, type_list<T...>> : std::common_type<
+        std::remove_cvref_t<decltype(traits::value_of<T>::from(std::declval<const B&>()))>...
+    > {};
+
+    template<typename T>
+    struct has_tape_opcode : std::false_type {};
+    template<typename op, typename... T> requires(sizeof...(T) == 1 or sizeof...(T) == 2)
+    struct has_tape_opcode<operation<op, T...>> : is_complete<traits::tape_opcode<op>> {};
+
+    template<typename T>
+    struct tape_instruction;
+    template<typename op, typename T1, typename T2>
+    struct tape_instruction<operation<op, T1, T2>> {
+        template<typename... N>
+        static constexpr bytecode::instruction in(const type_list<N...>& nodes) noexcept {
+            return {
+                traits::tape_opcode<op>::value,
+                register_of<T1>(nodes),
+                register_of<T2>(nodes),
+                register_of<operation<op, T1, T2>>(nodes)
+            };
+        }
+    };
+    template<typename op, typename T>
+    struct tape_instruction<operation<op, T>> {
+        template<typename... N>
+        static constexpr bytecode::instruction in(const type_list<N...>& nodes) noexcept {
+            return {
+                traits::tape_opcode<op>::value,
+                register_of<T>(nodes),
+                register_of<T>(nodes),
+                register_of<operation<op, T>>(nodes)
+            };
+        }
+    };
+
+}  // namespace detail
+#endif  // DOXYGEN
+
+/*!
+ * \brief Flat representation of a scalar expression as a sequence of instructions operating on registers.
+ * \details The registers hold the values of all unique nodes of the expression. The first registers hold the
+ *          leaf nodes, which are loaded from the value bindings, followed by the composite nodes in topological
+ *          order. The instructions are stored as constexpr data and are executed in a single loop, such that
+ *          the size of the generated code does not grow with the size of the expression.
+ *          Values bound to composite nodes are not taken into account.
+ */
+template<expression E>
+struct tape {
+    using leaf_nodes = traits::unique_leaf_nodes_of_t<E>;
+    using composite_nodes = typename detail::reversed<traits::unique_composite_nodes_of_t<E>>::type;
+    using nodes = merged_t<leaf_nodes, composite_nodes>;
+
+    //! The number of registers used during evaluation
+    static constexpr std::size_t registers = nodes::size;
+
+    //! The instructions to be executed in order
+    static constexpr auto instructions = [] <typename... C> (const type_list<C...>&) {
+        constexpr bool is_supported = std::conjunction_v<detail::has_tape_opcode<C>...>;
+        static_assert(
+            is_supported,
+            "Only operations with one or two operands and a registered tape_opcode can be compiled into tapes."
+        );
+        if constexpr (is_supported)
+            return std::array<bytecode::instruction, sizeof...(C)>{detail::tape_instruction<C>::in(nodes{})...};
+        else
+            return std::array<bytecode::instruction, 0>{};
+    } (composite_nodes{});
+
+    constexpr tape() = default;
+    constexpr tape(const E&) noexcept {}
+
+    //! Evaluate the tape at the given (bound) values
+    template<binder... V>
+    constexpr auto operator()(V&&... values) const noexcept {
+        return at(bindings{std::forward<V>(values)...});
+    }
+
+    //! Evaluate the tape at the given value bindings
+    template<typename... V>
+    constexpr auto operator()(const bindings<V...>& values) const noexcept {
+        return at(values);
+    }
+
+    //! Evaluate the tape at the given (bound) values
+    template<binder... V>
+    constexpr auto at(V&&... values) const noexcept {
+        return at(bindings{std::forward<V>(values)...});
+    }
+
+    //! Evaluate the tape at the given value bindings
+    template<typename... V>
+        requires(evaluatable_with<E, V...>)
+    constexpr auto at(const bindings<V...>& values) const noexcept {
+        using scalar = register_type_for<V...>;
+        std::array<scalar, registers> r{};
+        _load(r, values, leaf_nodes{});
+        for (const bytecode::instruction& i : instructions)
+            bytecode::execute(i, r);
+        return r[detail::register_of<E>(nodes{})];
+    }
+
+ private:
+    template<typename... V>
+    using register_type_for = typename detail::common_value_type<
+        bindings<V...>,
+        merged_t<type_list<E>, leaf_nodes>
+    >::type;
+
+    template<typename R, typename... V, typename... L>
+    static constexpr void _load(R& r, const bindings<V...>& values, const type_list<L...>&) noexcept {
+        (..., (r[detail::register_of<L>(nodes{})] = traits::value_of<L>::from(values)));
+    }
+};
+
+template<typename E>
+tape(const E&) -> tape<E>;
+
+//! Compile the given scalar expression into a tape
+template<expression E>
+inline constexpr auto compile_to_tape(const E& expression) noexcept {
+    return tape{expression};
+}
+
+//! \} group Expressions
+
+}  // namespace xp
@@ -7,6 +7,7 @@
  */
 #pragma once
 
+#include <array>
 #include <tuple>
 #include <ostream>
 
@@ -170,6 +171,37 @@ template<std::size_t n>
 using vector_expression_builder = tensor_expression_builder<md_shape<n>>;
 
 
+#ifndef DOXYGEN
+namespace detail {
+
+    template<typename F, typename E>
+    using entry_value_t = std::remove_cvref_t<std::invoke_result_t<const F&, const E&>>;
+
+    // evaluate the entries of a tensor expression, only storing those whose values are not known at compile time
+    template<typename shape, typename... E, typename F>
+    constexpr auto tensor_expression_value(const F& value_of_entry) noexcept {
+        constexpr bool has_constant_entries = (traits::is_constant_value_v<E> || ...);
+        constexpr bool has_scalar_entries = (is_scalar_v<entry_value_t<F, E>> && ...);
+        using first_entry_value = first_t<type_list<entry_value_t<F, E>...>>;
+        constexpr bool have_equal_types = (std::is_same_v<entry_value_t<F, E>, first_entry_value> && ...);
+        if constexpr (has_constant_entries and has_scalar_entries) {
+            using scalar = std::common_type_t<entry_value_t<F, E>...>;
+            using pattern = type_list<std::conditional_t<traits::is_constant_value_v<E>, E, linalg::stored_entry>...>;
+            return linalg::structured_tensor<scalar, shape, pattern>{
+                shape{}, std::array<scalar, shape::count>{static_cast<scalar>(value_of_entry(E{}))...}
+            };
+        } else if constexpr (!has_scalar_entries and !have_equal_types) {
+            // entries with different tensor types, e.g. with different structural zeros
+            using scalar = std::common_type_t<scalar_type_t<entry_value_t<F, E>>...>;
+            return linalg::tensor{shape{}, linalg::dense_copy_of<scalar>(value_of_entry(E{}))...};
+        } else {
+            return linalg::tensor{shape{}, value_of_entry(E{})...};
+        }
+    }
+
+}  // namespace detail
+#endif  // DOXYGEN
+
 namespace traits {
 
 template<typename shape, typename T, auto _>
@@ -234,7 +266,11 @@ template<typename shape, typename... E>
 struct value_of<tensor_expression<shape, E...>> {
     template<typename... V>
     static constexpr decltype(auto) from(const bindings<V...>& values) {
-        return linalg::tensor{shape{}, xp::value_of(E{}, values)...};
+        return xp::detail::instrumented_evaluation<tensor_expression<shape, E...>>(values, [&] () {
+            return xp::detail::tensor_expression_value<shape, E...>([&] <typename _E> (const _E&) {
+                return xp::value_of(_E{}, values);
+            });
+        });
     }
 };
 
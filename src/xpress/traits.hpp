@@ -201,6 +201,12 @@ struct is_zero_value : std::false_type {};
 template<typename T>
 inline constexpr bool is_zero_value_v = is_zero_value<T>::value;
 
+//! Trait to flag a type as representing a constant value
+template<typename T>
+struct is_constant_value : std::false_type {};
+template<typename T>
+inline constexpr bool is_constant_value_v = is_constant_value<T>::value;
+
 //! Trait to check if a type implements the required expression traits
 template<typename T>
 struct is_expression : std::bool_constant<
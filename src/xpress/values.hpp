@@ -43,6 +43,9 @@ struct is_unit_value<value<v>> : std::bool_constant<v == 1> {};
 template<auto v>
 struct is_zero_value<value<v>> : std::bool_constant<v == 0> {};
 
+template<auto v>
+struct is_constant_value<value<v>> : std::true_type {};
+
 template<auto v>
 struct nodes_of<value<v>> : std::type_identity<type_list<value<v>>> {};
 
@@ -7,3 +7,7 @@
 #include "symbols.hpp"
 #include "operators.hpp"
 #include "tensor.hpp"
+#include "factorize.hpp"
+#include "cost.hpp"
+#include "forward_ad.hpp"
+#include "shared_evaluation.hpp"
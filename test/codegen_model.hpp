@@ -0,0 +1,18 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <xpress/symbols.hpp>
+#include <xpress/operators.hpp>
+
+// model shared by the code generator and the test of the generated code
+namespace xp::testing::codegen_model {
+
+inline constexpr var a;
+inline constexpr var b;
+
+inline constexpr auto r1 = a*a*b - log(a*b) + val<3>;
+inline constexpr auto r2 = pow(a, b)/(a*b) + val<-1>*b;
+
+}  // namespace xp::testing::codegen_model
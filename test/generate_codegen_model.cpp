@@ -0,0 +1,21 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <fstream>
+
+#include <xpress/codegen.hpp>
+
+#include "codegen_model.hpp"
+
+int main(int argc, char** argv) {
+    using namespace xp;
+    using namespace xp::testing::codegen_model;
+
+    if (argc != 2)
+        return 1;
+
+    std::ofstream out{argv[1]};
+    out << "#include <cmath>\n\n";
+    generate_residual_and_jacobian(out, "residual_and_jacobian", wrt(a, b), r1, r2);
+    return 0;
+}
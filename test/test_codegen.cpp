@@ -0,0 +1,89 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <array>
+#include <limits>
+#include <sstream>
+#include <string>
+
+#include <xpress/symbols.hpp>
+#include <xpress/operators.hpp>
+#include <xpress/codegen.hpp>
+
+#include "codegen_model.hpp"
+#include "testing.hpp"
+
+// defined in the source file generated from the codegen model at build time
+void residual_and_jacobian(const double* in, double* out);
+
+int main() {
+    using namespace xp;
+    using namespace xp::testing;
+
+    "codegen_function"_test = [] () {
+        var a;
+        var b;
+        std::ostringstream out;
+        generate_function(out, "f", wrt(a, b), a*b + log(a*b)*val<2>);
+        expect(eq(out.str(), std::string{
+            "void f(const double* in, double* out) {\n"
+            "    const double t0 = in[0]*in[1];\n"
+            "    const double t1 = std::log(t0);\n"
+            "    const double t2 = t1*2.0;\n"
+            "    const double t3 = t0 + t2;\n"
+            "    out[0] = t3;\n"
+            "}\n"
+        }));
+    };
+
+    "codegen_function_shares_subexpressions_across_outputs"_test = [] () {
+        var a;
+        var b;
+        std::ostringstream out;
+        generate_function<float>(out, "f", wrt(a, b), a*b, val<1>/(b*a), a);
+        expect(eq(out.str(), std::string{
+            "void f(const float* in, float* out) {\n"
+            "    const float t0 = in[1]*in[0];\n"
+            "    const float t1 = 1.0f/t0;\n"
+            "    out[0] = t0;\n"
+            "    out[1] = t1;\n"
+            "    out[2] = in[0];\n"
+            "}\n"
+        }));
+    };
+
+    "codegen_function_non_finite_constants"_test = [] () {
+        var a;
+        std::ostringstream out;
+        constexpr double inf = std::numeric_limits<double>::infinity();
+        generate_function(out, "f", wrt(a), a*val<-inf>, val<std::numeric_limits<double>::quiet_NaN()>);
+        expect(eq(out.str(), std::string{
+            "void f(const double* in, double* out) {\n"
+            "    const double t0 = in[0]*(-std::numeric_limits<double>::infinity());\n"
+            "    out[0] = t0;\n"
+            "    out[1] = std::numeric_limits<double>::quiet_NaN();\n"
+            "}\n"
+        }));
+    };
+
+    "codegen_generated_residual_and_jacobian"_test = [] () {
+        using namespace codegen_model;
+        for (double va : {0.5, 1.0, 2.5}) {
+            for (double vb : {0.25, 1.5, 3.0}) {
+                const std::array in{va, vb};
+                std::array<double, 6> out;
+                residual_and_jacobian(in.data(), out.data());
+
+                const auto values = at(a = va, b = vb);
+                expect(fuzzy_eq(out[0], value_of(r1, values)));
+                expect(fuzzy_eq(out[1], value_of(r2, values)));
+                expect(fuzzy_eq(out[2], derivative_of(r1, wrt(a), values)));
+                expect(fuzzy_eq(out[3], derivative_of(r1, wrt(b), values)));
+                expect(fuzzy_eq(out[4], derivative_of(r2, wrt(a), values)));
+                expect(fuzzy_eq(out[5], derivative_of(r2, wrt(b), values)));
+            }
+        }
+    };
+
+    return 0;
+}
@@ -0,0 +1,118 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <string>
+#include <sstream>
+#include <type_traits>
+
+#include <xpress/symbols.hpp>
+#include <xpress/operators.hpp>
+#include <xpress/forward_ad.hpp>
+
+#include "testing.hpp"
+
+int main() {
+    using namespace xp;
+    using namespace xp::testing;
+
+    "comparison_values"_test = [] () {
+        var a;
+        var b;
+        static_assert(value_of(a < b, at(a = 1, b = 2)));
+        static_assert(!value_of(a > b, at(a = 1, b = 2)));
+        static_assert(value_of(a <= b, at(a = 2, b = 2)));
+        static_assert(value_of(a >= b, at(a = 2, b = 2)));
+        static_assert(value_of(a*a < b + val<1>, at(a = 1.0, b = 1.0)));
+    };
+
+    "comparison_of_constants_is_folded"_test = [] () {
+        static_assert(std::is_same_v<decltype(val<1> < val<2>), value<true>>);
+        static_assert(std::is_same_v<decltype(val<1> > val<2>), value<false>>);
+    };
+
+    "select_values"_test = [] () {
+        var a;
+        var b;
+        const auto expression = select(a < b, a*b, a + b);
+        static_assert(value_of(expression, at(a = 2, b = 3)) == 6);
+        static_assert(value_of(expression, at(a = 3, b = 2)) == 5);
+    };
+
+    "select_simplifications"_test = [] () {
+        var a;
+        var b;
+        static_assert(std::is_same_v<decltype(select(val<1> < val<2>, a, b)), std::remove_cvref_t<decltype(a)>>);
+        static_assert(std::is_same_v<decltype(select(val<1> > val<2>, a, b)), std::remove_cvref_t<decltype(b)>>);
+        static_assert(std::is_same_v<decltype(select(a < b, a*b, a*b)), std::remove_cvref_t<decltype(a*b)>>);
+    };
+
+    "min_max_abs"_test = [] () {
+        var a;
+        var b;
+        static_assert(value_of(min(a, b), at(a = 2.0, b = -1.0)) == -1.0);
+        static_assert(value_of(max(a, b), at(a = 2.0, b = -1.0)) == 2.0);
+        static_assert(value_of(abs(a), at(a = -3.0)) == 3.0);
+        static_assert(value_of(abs(a), at(a = 4.0)) == 4.0);
+    };
+
+    "select_derivatives"_test = [] () {
+        var a;
+        var b;
+        const auto expression = select(a < b, a*a, b*a);
+        static_assert(derivative_of(expression, wrt(a), at(a = 1.0, b = 2.0)) == 2.0);
+        static_assert(derivative_of(expression, wrt(a), at(a = 3.0, b = 2.0)) == 2.0);
+        static_assert(derivative_of(expression, wrt(b), at(a = 1.0, b = 2.0)) == 0.0);
+        static_assert(derivative_of(expression, wrt(b), at(a = 3.0, b = 2.0)) == 3.0);
+        static_assert(derivative_of(abs(a), wrt(a), at(a = -3.0)) == -1.0);
+        static_assert(derivative_of(abs(a), wrt(a), at(a = 3.0)) == 1.0);
+    };
+
+    "derivative_of_select_with_constant_branches_vanishes"_test = [] () {
+        var a;
+        var b;
+        static_assert(std::is_same_v<decltype(derivative_of(select(a < b, b, val<1>), wrt(a))), value<0>>);
+    };
+
+    "select_forward_ad"_test = [] () {
+        var a;
+        var b;
+        const auto expression = max(a*a, b*a) + abs(a - b);
+        for (const auto& values : {at(a = 1.0, b = 2.0), at(a = 3.0, b = 2.0), at(a = -1.5, b = 0.5)}) {
+            expect(fuzzy_eq(
+                derivative_of<differentiation::forward_ad>(expression, wrt(a), values),
+                derivative_of(expression, wrt(a), values)
+            ));
+            expect(fuzzy_eq(
+                derivative_of<differentiation::forward_ad>(expression, wrt(b), values),
+                derivative_of(expression, wrt(b), values)
+            ));
+        }
+    };
+
+    "select_forward_ad_with_constant_branches"_test = [] () {
+        var a;
+        static_assert(std::is_same_v<std::common_type_t<dual<double>, int>, dual<double>>);
+        static_assert(std::is_same_v<std::common_type_t<int, dual<double>>, dual<double>>);
+        const auto matches_symbolic = [&] (const auto& expression) {
+            for (const double value : {-2.0, 3.0})
+                expect(fuzzy_eq(
+                    derivative_of<differentiation::forward_ad>(expression, wrt(a), at(a = value)),
+                    static_cast<double>(derivative_of(expression, wrt(a), at(a = value)))
+                ));
+        };
+        matches_symbolic(max(a, val<0>));
+        matches_symbolic(min(a*a, val<1>));
+        matches_symbolic(select(a < val<0>, a, val<0>));
+        matches_symbolic(abs(a));
+    };
+
+    "conditional_stream"_test = [] () {
+        var a;
+        var b;
+        std::ostringstream out;
+        write_to(out, select(a*b < b, a, b), with(a = "a", b = "b"));
+        expect(eq(out.str(), std::string{"select((a*b) < b, a, b)"}));
+    };
+
+    return 0;
+}
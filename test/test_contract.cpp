@@ -0,0 +1,131 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <array>
+#include <string>
+#include <sstream>
+
+#include <xpress/operators.hpp>
+#include <xpress/symbols.hpp>
+#include <xpress/tensor.hpp>
+
+#include "testing.hpp"
+
+template<xp::operators::contraction_spec spec, typename shape1, typename shape2>
+using plan = xp::detail::contraction_plan<spec, shape1, shape2>;
+
+int main() {
+    using namespace xp;
+    using namespace xp::testing;
+
+    "contraction_spec"_test = [] () {
+        constexpr operators::contraction_spec spec{"ijkl,kl->ij"};
+        static_assert(spec.operand(0) == "ijkl");
+        static_assert(spec.operand(1) == "kl");
+        static_assert(spec.result() == "ij");
+        static_assert(spec.is_well_formed());
+        static_assert(operators::contraction_spec{"ij,ij->"}.is_well_formed());
+        static_assert(!operators::contraction_spec{"ij,jk"}.is_well_formed());
+        static_assert(!operators::contraction_spec{"ij->ik"}.is_well_formed());
+        static_assert(!operators::contraction_spec{"i j,jk->ik"}.is_well_formed());
+    };
+
+    "contraction_loop_order"_test = [] () {
+        // summed indices are innermost, ordered such that the innermost one has the smallest strides
+        using mat_mul_plan = plan<"ij,jk->ik", md_shape<2, 3>, md_shape<3, 4>>;
+        static_assert(mat_mul_plan::loop_labels == std::array{'i', 'k', 'j'});
+        static_assert(mat_mul_plan::term_count == 2*3*4);
+        static_assert(mat_mul_plan::result_strides == std::array<std::size_t, 3>{4, 1, 0});
+        static_assert(mat_mul_plan::first_strides == std::array<std::size_t, 3>{3, 0, 1});
+        static_assert(mat_mul_plan::second_strides == std::array<std::size_t, 3>{0, 1, 4});
+        static_assert(mat_mul_plan::terms[1].result == 0);
+        static_assert(mat_mul_plan::terms[1].first == 1);
+        static_assert(mat_mul_plan::terms[1].second == 4);
+        using ddot_plan = plan<"ij,ji->", md_shape<3, 3>, md_shape<3, 3>>;
+        static_assert(ddot_plan::loop_labels == std::array{'i', 'j'});
+        using apply_plan = plan<"ijkl,kl->ij", md_shape<3, 3, 3, 3>, md_shape<3, 3>>;
+        static_assert(apply_plan::loop_labels == std::array{'i', 'j', 'k', 'l'});
+        using reordered_plan = plan<"ji,ijk->k", md_shape<3, 3>, md_shape<3, 3, 3>>;
+        static_assert(reordered_plan::loop_labels == std::array{'k', 'i', 'j'});
+        static_assert(!plan<"ij,jk->ik", md_shape<2, 3>, md_shape<2, 2>>::is_consistent);
+        static_assert(!plan<"ij,jk->ii", md_shape<2, 2>, md_shape<2, 2>>::is_consistent);
+    };
+
+    "contraction_matches_mat_mul"_test = [] () {
+        const tensor A{shape<2, 3>};
+        const tensor B{shape<3, 2>};
+        constexpr linalg::tensor A_value{shape<2, 3>, 1, 2, 3, 4, 5, 6};
+        constexpr linalg::tensor B_value{shape<3, 2>, 7, 8, 9, 10, 11, 12};
+        static_assert(
+            value_of(contract<"ij,jk->ik">(A, B), at(A = A_value, B = B_value))
+            == linalg::mat_mul(A_value, B_value)
+        );
+        static_assert(
+            value_of(contract<"ij,jk->ki">(A, B), at(A = A_value, B = B_value))
+            == linalg::tensor{shape<2, 2>, 58, 139, 64, 154}
+        );
+    };
+
+    "contraction_to_scalar"_test = [] () {
+        const tensor A{shape<2, 2>};
+        const tensor B{shape<2, 2>};
+        constexpr linalg::tensor A_value{shape<2, 2>, 1.0, 2.0, 3.0, 4.0};
+        constexpr linalg::tensor B_value{shape<2, 2>, 5.0, 6.0, 7.0, 8.0};
+        static_assert(value_of(contract<"ij,ij->">(A, B), at(A = A_value, B = B_value)) == 5.0 + 12.0 + 21.0 + 32.0);
+        static_assert(value_of(contract<"ij,ji->">(A, B), at(A = A_value, B = B_value)) == 5.0 + 14.0 + 18.0 + 32.0);
+    };
+
+    "contraction_of_fourth_order_tensor"_test = [] () {
+        const tensor C{shape<2, 2, 2, 2>};
+        const tensor E{shape<2, 2>};
+        linalg::tensor<double, md_shape<2, 2, 2, 2>> C_value{};
+        // symmetric identity: C_ijkl = (d_ik d_jl + d_il d_jk)/2
+        for (std::size_t i = 0; i < 2; ++i)
+            for (std::size_t j = 0; j < 2; ++j)
+                for (std::size_t k = 0; k < 2; ++k)
+                    for (std::size_t l = 0; l < 2; ++l)
+                        C_value[i, j, k, l] = 0.5*((i == k && j == l) + (i == l && j == k));
+        const linalg::tensor E_value{shape<2, 2>, 1.0, 2.0, 4.0, 3.0};
+        expect(value_of(contract<"ijkl,kl->ij">(C, E), at(C = C_value, E = E_value))
+               == linalg::tensor{shape<2, 2>, 1.0, 3.0, 3.0, 3.0});
+    };
+
+    "contraction_derivatives"_test = [] () {
+        const tensor A{shape<2, 2>};
+        const tensor B{shape<2, 2>};
+        constexpr linalg::tensor A_value{shape<2, 2>, 1, 2, 3, 4};
+        constexpr linalg::tensor B_value{shape<2, 2>, 5, 6, 7, 8};
+        const auto ddot = contract<"ij,ij->">(A, B);
+        expect(derivative_of(ddot, wrt(A), at(A = A_value, B = B_value)) == B_value);
+        expect(derivative_of(ddot, wrt(B), at(A = A_value, B = B_value)) == A_value);
+        expect(eq(derivative_of(ddot, wrt(A[md_ic<1, 0>]), at(A = A_value, B = B_value)), 7));
+    };
+
+    "tensor_expression_contraction_derivative"_test = [] () {
+        var a;
+        var b;
+        const tensor A{shape<2, 2>};
+        const auto B = tensor_expression_builder{shape<2, 2>}
+                        .with(a*b, at<0, 0>())
+                        .with(a, at<0, 1>())
+                        .with(b, at<1, 0>())
+                        .with(a + b, at<1, 1>())
+                        .build();
+        constexpr linalg::tensor A_value{shape<2, 2>, 1, 2, 3, 4};
+        const auto values = at(A = A_value, a = 5, b = 7);
+        const auto ddot = contract<"ij,ij->">(A, B);
+        expect(eq(value_of(ddot, values), 1*35 + 2*5 + 3*7 + 4*12));
+        expect(eq(derivative_of(ddot, wrt(a), values), 1*7 + 2 + 4));
+        expect(eq(derivative_of(ddot, wrt(b), values), 1*5 + 3 + 4));
+    };
+
+    "contraction_stream"_test = [] () {
+        const tensor A{shape<2, 2>};
+        const tensor B{shape<2, 2>};
+        std::ostringstream s;
+        write_to(s, contract<"ij,jk->ik">(A, B), at(A = "A", B = "B"));
+        expect(eq(s.str(), std::string{"contract<ij,jk->ik>(A, B)"}));
+    };
+
+    return 0;
+}
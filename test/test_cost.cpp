@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+
+#include <xpress/symbols.hpp>
+#include <xpress/operators.hpp>
+#include <xpress/cost.hpp>
+
+#include "testing.hpp"
+
+struct custom_operator {};
+template<> struct xp::operators::traits::cost<custom_operator> : std::integral_constant<std::size_t, 7> {};
+
+int main() {
+    using namespace xp;
+    using namespace xp::testing;
+
+    "cost_of_leaf"_test = [] () {
+        var a;
+        static_assert(cost_of(a).nodes == 1);
+        static_assert(cost_of(a).unique_nodes == 1);
+        static_assert(cost_of(a).depth == 1);
+        static_assert(cost_of(a).operations() == 0);
+        static_assert(cost_of(a).weight == 0);
+    };
+
+    "cost_of_operation_counts"_test = [] () {
+        var a;
+        var b;
+        constexpr auto cost = cost_of(pow(a*b, b)/log(a*b) + a - b);
+        static_assert(cost.nodes == 14);
+        static_assert(cost.unique_nodes == 8);
+        static_assert(cost.depth == 6);
+        static_assert(cost.additions == 1);
+        static_assert(cost.subtractions == 1);
+        static_assert(cost.multiplications == 2);
+        static_assert(cost.divisions == 1);
+        static_assert(cost.powers == 1);
+        static_assert(cost.logarithms == 1);
+        static_assert(cost.operations() == 7);
+        static_assert(cost.weight == 1 + 1 + 2 + 4 + 20 + 15);
+        static_assert(cost.unique_weight == 1 + 1 + 1 + 4 + 20 + 15);
+    };
+
+    "cost_of_custom_operator_weight"_test = [] () {
+        var a;
+        var b;
+        constexpr auto cost = traits::cost_of_v<operation<custom_operator, decltype(a), decltype(b)>>;
+        static_assert(cost.other_operations == 1);
+        static_assert(cost.weight == 7);
+    };
+
+    "cost_of_derivative_growth"_test = [] () {
+        var a;
+        var b;
+        constexpr auto sum = a + b + a + b;
+        constexpr auto product = a*b*a*b;
+        static_assert(cost_of(sum).derivative_growth() == 1.0);
+        static_assert(cost_of(product).derivative_growth() > 2.0);
+        static_assert(cost_of(product*product).derivative_growth() > cost_of(product).derivative_growth());
+    };
+
+    "cost_of_budget"_test = [] () {
+        var a;
+        var b;
+        constexpr auto expression = a*a*b + log(b);
+        static_assert(cost_of(expression).weight <= 20, "expression exceeds evaluation budget");
+        expect(eq(cost_of(expression).nodes, std::size_t{8}));
+    };
+
+    return 0;
+}
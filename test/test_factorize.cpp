@@ -0,0 +1,89 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <type_traits>
+
+#include <xpress/symbols.hpp>
+#include <xpress/operators.hpp>
+#include <xpress/tensor.hpp>
+#include <xpress/factorize.hpp>
+
+#include "testing.hpp"
+
+int main() {
+    using namespace xp;
+    using namespace xp::testing;
+
+    "factorize_common_multiplicand"_test = [] () {
+        var a;
+        var b;
+        var c;
+        constexpr auto factorized = factorize(a*b + a*c);
+        static_assert(std::is_same_v<std::remove_cvref_t<decltype(factorized)>, decltype(a*(b + c))>);
+        static_assert(value_of(factorized, at(a = 2, b = 3, c = 4)) == 14);
+    };
+
+    "factorize_common_multiplicand_with_subtraction"_test = [] () {
+        var a;
+        var b;
+        var c;
+        constexpr auto factorized = factorize(b*a - a*c);
+        static_assert(std::is_same_v<std::remove_cvref_t<decltype(factorized)>, decltype(a*(b - c))>);
+        static_assert(value_of(factorized, at(a = 2, b = 3, c = 4)) == -2);
+    };
+
+    "factorize_unit_remainder"_test = [] () {
+        var a;
+        var b;
+        constexpr auto factorized = factorize(a + a*b);
+        static_assert(std::is_same_v<std::remove_cvref_t<decltype(factorized)>, decltype(a*(val<1> + b))>);
+    };
+
+    "factorize_horner_form"_test = [] () {
+        let c0;
+        let c1;
+        let c2;
+        let c3;
+        var x;
+        constexpr auto polynomial = c0 + c1*x + c2*x*x + c3*x*x*x;
+        constexpr auto factorized = factorize(polynomial);
+        static_assert(std::is_same_v<
+            std::remove_cvref_t<decltype(factorized)>,
+            decltype(c0 + x*(c1 + x*(c2 + c3*x)))
+        >);
+
+        constexpr auto values = at(c0 = 1.0, c1 = 2.0, c2 = 3.0, c3 = 4.0, x = 0.5);
+        static_assert(fuzzy_eq(value_of(factorized, values), value_of(polynomial, values)));
+        expect(fuzzy_eq(value_of(factorized, values), 3.25));
+    };
+
+    "factorize_nested"_test = [] () {
+        var a;
+        var b;
+        var c;
+        constexpr auto factorized = factorize(log(a*b + a*c));
+        static_assert(std::is_same_v<std::remove_cvref_t<decltype(factorized)>, decltype(log(a*(b + c)))>);
+    };
+
+    "factorize_without_common_factors"_test = [] () {
+        var a;
+        var b;
+        var c;
+        constexpr auto expression = a*b + val<2>*c - val<3>;
+        static_assert(std::is_same_v<decltype(factorize(expression)), std::remove_cvref_t<decltype(expression)>>);
+    };
+
+    "factorize_tensor_expression"_test = [] () {
+        var a;
+        var b;
+        var c;
+        constexpr auto expression = vector_expression::from(a*b + a*c, a);
+        constexpr auto factorized = factorize(expression);
+        static_assert(std::is_same_v<
+            std::remove_cvref_t<decltype(factorized)>,
+            decltype(vector_expression::from(a*(b + c), a))
+        >);
+    };
+
+    return 0;
+}
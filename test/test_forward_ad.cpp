@@ -0,0 +1,84 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <type_traits>
+
+#include <xpress/symbols.hpp>
+#include <xpress/operators.hpp>
+#include <xpress/forward_ad.hpp>
+
+#include "testing.hpp"
+
+int main() {
+    using namespace xp;
+    using namespace xp::testing;
+
+    "dual_arithmetic"_test = [] () {
+        constexpr dual x{2.0, 1.0};
+        static_assert((x*x).derivative == 4.0);
+        static_assert((x/x).derivative == 0.0);
+        static_assert((3*x - 1).value == 5.0);
+        static_assert((3*x - 1).derivative == 3.0);
+        static_assert((1.0/x).derivative == -0.25);
+    };
+
+    "forward_ad_matches_symbolic_derivatives"_test = [] () {
+        var a;
+        var b;
+        let c;
+        const auto expression = a*a*b + pow(a, b) - log(a)/b + c*a - val<2>/b;
+        const auto values = at(a = 1.5, b = 2.5, c = 3.0);
+        expect(fuzzy_eq(
+            derivative_of<differentiation::forward_ad>(expression, wrt(a), values),
+            derivative_of(expression, wrt(a), values)
+        ));
+        expect(fuzzy_eq(
+            derivative_of<differentiation::forward_ad>(expression, wrt(b), values),
+            derivative_of(expression, wrt(b), values)
+        ));
+        expect(eq(derivative_of<differentiation::forward_ad>(expression, wrt(c), values), 1.5));
+    };
+
+    "forward_ad_constant_exponent"_test = [] () {
+        var a;
+        const auto expression = pow(a, val<3>);
+        expect(fuzzy_eq(derivative_of<differentiation::forward_ad>(expression, wrt(a), at(a = -2.0)), 12.0));
+    };
+
+    "forward_ad_integral_values"_test = [] () {
+        var a;
+        var b;
+        expect(eq(derivative_of<differentiation::forward_ad>(a*b, wrt(a), at(a = 2, b = 3)), 3.0));
+    };
+
+    "forward_ad_constexpr"_test = [] () {
+        var a;
+        var b;
+        static_assert(derivative_of<differentiation::forward_ad>(a*b*a, wrt(a), at(a = 2.0, b = 3.0)) == 12.0);
+    };
+
+    "automatic_differentiation_mode"_test = [] () {
+        var a;
+        var b;
+        const auto small = a*b;
+        const auto large = small*small*small*small*small*small*small*small*small;
+        static_assert(traits::cost_of<std::remove_cvref_t<decltype(small)>>::value.derivative_nodes
+                      <= traits::max_symbolic_derivative_nodes);
+        static_assert(traits::cost_of<std::remove_cvref_t<decltype(large)>>::value.derivative_nodes
+                      > traits::max_symbolic_derivative_nodes);
+        static_assert(std::is_same_v<
+            traits::differentiation_mode_t<std::remove_cvref_t<decltype(small)>, decltype(a)>,
+            differentiation::symbolic
+        >);
+        static_assert(std::is_same_v<
+            traits::differentiation_mode_t<std::remove_cvref_t<decltype(large)>, decltype(a)>,
+            differentiation::forward_ad
+        >);
+        expect(fuzzy_eq(
+            derivative_of<differentiation::automatic>(large, wrt(a), at(a = 1.1, b = 0.9)),
+            derivative_of<differentiation::symbolic>(large, wrt(a), at(a = 1.1, b = 0.9))
+        ));
+    };
+
+    return 0;
+}
@@ -3,6 +3,8 @@
 
 #include <array>
 #include <algorithm>
+#include <functional>
+#include <type_traits>
 
 #include <xpress/linalg.hpp>
 
@@ -104,6 +106,146 @@ int main() {
         expect(std::ranges::equal(copied[0], std::array{1, 2, 3}));
     };
 
+    "tensor_transpose_and_trace"_test = [] () {
+        constexpr linalg::tensor A{shape<2, 3>, 1, 2, 3, 4, 5, 6};
+        static_assert(linalg::transpose_of(A) == linalg::tensor{shape<3, 2>, 1, 4, 2, 5, 3, 6});
+        static_assert(linalg::trace_of(linalg::tensor{shape<3, 3>, 1, 2, 3, 4, 5, 6, 7, 8, 9}) == 15);
+    };
+
+    "tensor_inverse"_test = [] () {
+        const auto is_identity = [] <typename T> (const T& t) {
+            bool result = true;
+            visit_indices_in(shape_of_t<T>{}, [&] <std::size_t i, std::size_t j> (const md_index<i, j>& idx) {
+                result = result && fuzzy_eq(t[idx], i == j ? 1.0 : 0.0, 1e-12);
+            });
+            return result;
+        };
+        constexpr linalg::tensor A2{shape<2, 2>, 1.0, 2.0, 3.0, 4.0};
+        constexpr linalg::tensor A3{shape<3, 3>, 1.0, 2.0, 3.0, 3.0, 2.0, 1.0, 2.0, 1.0, 3.0};
+        constexpr linalg::tensor A4{shape<4, 4>,
+            0.0, 2.0, 1.0, 4.0,
+            1.0, 1.0, 0.0, 2.0,
+            3.0, 0.0, 1.0, 1.0,
+            2.0, 5.0, 1.0, 0.0
+        };
+        static_assert(linalg::inverse_of(A2) == linalg::tensor{shape<2, 2>, -2.0, 1.0, 1.5, -0.5});
+        static_assert(
+            linalg::inverse_of(linalg::tensor{shape<2, 2>, 2, 0, 0, 4})
+            == linalg::tensor{shape<2, 2>, 0.5, 0.0, 0.0, 0.25}
+        );
+        expect(is_identity(linalg::mat_mul(A2, linalg::inverse_of(A2))));
+        expect(is_identity(linalg::mat_mul(A3, linalg::inverse_of(A3))));
+        expect(is_identity(linalg::mat_mul(A4, linalg::inverse_of(A4))));
+        expect(is_identity(linalg::mat_mul(linalg::inverse_of(A4), A4)));
+    };
+
+    "cholesky_solve"_test = [] () {
+        constexpr linalg::tensor A{shape<3, 3>,
+            4.0, 2.0, 0.0,
+            2.0, 5.0, 1.0,
+            0.0, 1.0, 3.0
+        };
+        constexpr linalg::tensor b{shape<3>, 6.0, 8.0, 4.0};
+        constexpr auto x = linalg::cholesky_solve(A, b);
+        static_assert(x.has_value());
+        static_assert(fuzzy_eq((*x)[0], 1.0) && fuzzy_eq((*x)[1], 1.0) && fuzzy_eq((*x)[2], 1.0));
+
+        constexpr linalg::symmetric_tensor<double, 3> S{4.0, 5.0, 3.0, 1.0, 0.0, 2.0};
+        static_assert(linalg::cholesky_solve(S, b) == x);
+        expect(!linalg::cholesky_solve(
+            linalg::tensor{shape<2, 2>, 1.0, 2.0, 2.0, 1.0}, linalg::tensor{shape<2>, 1.0, 1.0}
+        ).has_value());
+    };
+
+    "symmetric_tensor_storage"_test = [] () {
+        static_assert(sizeof(linalg::symmetric_tensor<double, 3>) == 6*sizeof(double));
+        static_assert(tensorial<linalg::symmetric_tensor<double, 3>>);
+        static_assert(shape_of_t<linalg::symmetric_tensor<double, 3>>{} == shape<3, 3>);
+
+        // Voigt order: 00, 11, 22, 12, 02, 01
+        constexpr linalg::symmetric_tensor<int, 3> S{1, 2, 3, 4, 5, 6};
+        static_assert(S[md_ic<0, 0>] == 1 && S[md_ic<1, 1>] == 2 && S[md_ic<2, 2>] == 3);
+        static_assert(S[md_ic<1, 2>] == 4 && S[md_ic<2, 1>] == 4);
+        static_assert(S[md_ic<0, 2>] == 5 && S[md_ic<2, 0>] == 5);
+        static_assert(S[md_ic<0, 1>] == 6 && S[1, 0] == 6);
+        static_assert(S == linalg::tensor{shape<3, 3>, 1, 6, 5, 6, 2, 4, 5, 4, 3});
+
+        linalg::symmetric_tensor<int, 2> T{0};
+        access<linalg::symmetric_tensor<int, 2>>::at(md_ic<1, 0>, T) = 42;
+        expect(eq(T[0, 1], 42));
+        expect(eq(T.voigt()[2], 42));
+    };
+
+    "symmetric_tensor_kernels"_test = [] () {
+        constexpr linalg::symmetric_tensor<double, 3> S{4.0, 5.0, 6.0, 1.0, 2.0, 3.0};
+        constexpr linalg::tensor F{shape<3, 3>, 4.0, 3.0, 2.0, 3.0, 5.0, 1.0, 2.0, 1.0, 6.0};
+        expect(fuzzy_eq(linalg::determinant_of(S), linalg::determinant_of(F)));
+        static_assert(linalg::determinant_of(linalg::symmetric_tensor<int, 2>{1, 2, 3}) == -7);
+        static_assert(linalg::transpose_of(S) == S);
+        static_assert(linalg::double_contraction_of(S, S) == 16.0 + 25.0 + 36.0 + 2.0*(1.0 + 4.0 + 9.0));
+
+        const auto S_inv = linalg::inverse_of(S);
+        const auto F_inv = linalg::inverse_of(F);
+        static_assert(std::is_same_v<std::remove_cvref_t<decltype(S_inv)>, linalg::symmetric_tensor<double, 3>>);
+        visit_indices_in(shape<3, 3>, [&] (const auto& idx) {
+            expect(fuzzy_eq(S_inv[idx], F_inv[idx], 1e-14));
+        });
+        expect(linalg::inverse_of(linalg::symmetric_tensor<double, 2>{2.0, 2.0, 1.0})
+               == linalg::symmetric_tensor<double, 2>{2.0/3.0, 2.0/3.0, -1.0/3.0});
+        expect(linalg::mat_mul(S, linalg::tensor{shape<3>, 1.0, 0.0, 0.0}) == linalg::tensor{shape<3>, 4.0, 3.0, 2.0});
+    };
+
+    "structured_tensor_storage"_test = [] () {
+        using pattern = type_list<linalg::stored_entry, value<0>, value<2>, linalg::stored_entry>;
+        using structured = linalg::structured_tensor<double, md_shape<2, 2>, pattern>;
+        static_assert(structured::stored_count == 2);
+        static_assert(structured::is_zero == std::array{false, true, false, false});
+        static_assert(linalg::structural_zeros_v<structured> == structured::is_zero);
+        static_assert(linalg::structural_zeros_v<linalg::tensor<double, md_shape<2, 2>>> == std::array<bool, 4>{});
+
+        constexpr structured S{std::array{1.0, 4.0}};
+        static_assert(S[at<0, 0>()] == 1.0 && S[at<0, 1>()] == 0.0 && S[at<1, 0>()] == 2.0 && S[at<1, 1>()] == 4.0);
+        static_assert(S[1, 0] == 2.0 && S[1, 1] == 4.0);
+        static_assert(S == linalg::tensor{shape<2, 2>, 1.0, 0.0, 2.0, 4.0});
+        static_assert(linalg::tensor{shape<2, 2>, 1.0, 0.0, 2.0, 4.0} == S);
+        static_assert(structured{shape<2, 2>, std::array{1.0, 7.0, 2.0, 4.0}} == S);
+
+        structured T{0.0};
+        T[at<1, 1>()] = 3.0;
+        expect(eq(T.stored()[1], 3.0));
+        static_assert(tensorial<structured>);
+    };
+
+    "structured_tensor_kernels"_test = [] () {
+        using diagonal = linalg::structured_tensor<
+            double, md_shape<2, 2>, type_list<linalg::stored_entry, value<0>, value<0>, linalg::stored_entry>
+        >;
+        using column = linalg::structured_tensor<
+            double, md_shape<2, 2>, type_list<value<0>, linalg::stored_entry, value<0>, linalg::stored_entry>
+        >;
+        constexpr diagonal D{std::array{2.0, 3.0}};
+        constexpr column C{std::array{1.0, 4.0}};
+        constexpr linalg::tensor A{shape<2, 2>, 1.0, 2.0, 3.0, 4.0};
+
+        // the zero column of C remains zero in the product
+        constexpr auto AC = linalg::mat_mul(A, C);
+        static_assert(linalg::structural_zeros_v<std::remove_cvref_t<decltype(AC)>> == C.is_zero);
+        static_assert(AC == linalg::tensor{shape<2, 2>, 0.0, 9.0, 0.0, 19.0});
+        static_assert(linalg::mat_mul(D, A) == linalg::tensor{shape<2, 2>, 2.0, 4.0, 9.0, 12.0});
+        static_assert(linalg::mat_mul(D, linalg::tensor{shape<2>, 1.0, 1.0}) == linalg::tensor{shape<2>, 2.0, 3.0});
+
+        // products of dense tensors stay dense
+        using dense_product = decltype(linalg::mat_mul(A, A));
+        static_assert(std::is_same_v<dense_product, linalg::tensor<double, md_shape<2, 2>>>);
+
+        // sums fold the entries known at compile time
+        constexpr auto DC = linalg::structured_transform(D, C, std::plus{});
+        using sum_type = std::remove_cvref_t<decltype(DC)>;
+        static_assert(sum_type::stored_count == 3);
+        static_assert(sum_type::is_zero == std::array{false, false, true, false});
+        static_assert(DC == linalg::tensor{shape<2, 2>, 2.0, 1.0, 0.0, 7.0});
+    };
+
     "tensor_concept"_test = [] () {
         static_assert(tensorial<linalg::tensor<int, md_shape<2, 2>>>);
     };
@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <type_traits>
+
+#include <xpress/symbols.hpp>
+#include <xpress/operators.hpp>
+#include <xpress/tensor.hpp>
+
+#include "testing.hpp"
+
+template<typename T1, typename T2>
+inline constexpr bool verify_same = std::is_same_v<T1, T2>;
+
+int main() {
+    using namespace xp;
+    using namespace xp::testing;
+
+    "sized_float_dtypes"_test = [] () {
+        using namespace xp::dtype;
+        using namespace xp::traits;
+        static_assert(bindable_to<float, float32>);
+        static_assert(bindable_to<const float&, float32>);
+        static_assert(!bindable_to<double, float32>);
+        static_assert(!bindable_to<int, float32>);
+        static_assert(bindable_to<double, float64>);
+        static_assert(!bindable_to<float, float64>);
+        static_assert(bindable_to<linalg::tensor<float, md_shape<2, 2>>, float32>);
+        static_assert(!bindable_to<linalg::tensor<double, md_shape<2, 2>>, float32>);
+        static_assert(bindable_to<float, real>);
+
+        static_assert(verify_same<common_dtype_t<float32, float64>, float64>);
+        static_assert(verify_same<common_dtype_t<float64, float32>, float64>);
+        static_assert(verify_same<common_dtype_t<float32, integral>, float32>);
+        static_assert(verify_same<common_dtype_t<integral, float64>, float64>);
+        static_assert(verify_same<common_dtype_t<float32, real>, real>);
+        static_assert(verify_same<common_dtype_t<float32, int>, float32>);
+        static_assert(verify_same<common_dtype_t<double, float32>, real>);
+        static_assert(verify_same<common_dtype_t<float32, any>, any>);
+    };
+
+    "sized_float_symbols"_test = [] () {
+        var<dtype::float32> a;
+        var<dtype::float64> b;
+        static_assert(verify_same<traits::dtype_of_t<decltype(a*b)>, dtype::float64>);
+        static_assert(verify_same<traits::dtype_of_t<decltype(a*val<2>)>, dtype::float32>);
+        expect(eq(value_of(a*b, at(a = 2.0f, b = 3.0)), 6.0));
+    };
+
+    "mixed_precision_accumulation"_test = [] () {
+        var<dtype::float32> a;
+        var<dtype::float32> b;
+        const auto values = at(a = 1e8f, b = 1.0f);
+
+        // the sum is evaluated in double, the product in float
+        const auto sum = value_of<policy::mixed_precision<double>>(a + b, values);
+        static_assert(verify_same<decltype(sum), const double>);
+        expect(eq(sum, 1e8 + 1.0));
+        expect(eq(value_of(a + b, values), 1e8f));
+
+        const auto product = value_of<policy::mixed_precision<double>>(a*b, values);
+        static_assert(verify_same<decltype(product), const float>);
+
+        const auto all_double = value_of<policy::mixed_precision<double, double>>(a*b, values);
+        static_assert(verify_same<decltype(all_double), const double>);
+    };
+
+    "mixed_precision_tensor_operators"_test = [] () {
+        const tensor A{shape<2, 2>};
+        const tensor B{shape<2, 2>};
+        const linalg::tensor<float, md_shape<2, 2>> m{md_shape<2, 2>{}, 1e8f, 1.0f, 1.0f, 1.0f};
+        const linalg::tensor<float, md_shape<2, 2>> n{md_shape<2, 2>{}, 1.0f, 0.0f, 1.0f, 1.0f};
+
+        const auto product = value_of<policy::mixed_precision<double>>(mat_mul(A, B), at(A = m, B = n));
+        static_assert(verify_same<scalar_type_t<std::remove_cvref_t<decltype(product)>>, double>);
+        expect(eq(product[0, 0], 1e8 + 1.0));
+
+        const auto determinant = value_of<policy::mixed_precision<double>>(det(A), at(A = m));
+        static_assert(verify_same<decltype(determinant), const double>);
+        expect(eq(determinant, 1e8 - 1.0));
+    };
+
+    "mixed_precision_with_fast_policy"_test = [] () {
+        var a;
+        var b;
+        const auto values = at(a = 2.0f, b = 4.0f);
+        const auto result = value_of<policy::mixed_precision<double, double, policy::fast>>(log(a) + b, values);
+        static_assert(verify_same<decltype(result), const double>);
+        expect(fuzzy_eq(result, std::log(2.0) + 4.0, 1e-14));
+    };
+
+    return 0;
+}
@@ -317,7 +317,7 @@ int main() {
         var b;
         auto sum_1 = a + b;
         auto sum_2 = b + a;
-        auto expr = sum_1 + sum_2;
+        auto expr = sum_1*sum_2;
 
         using nodes = nodes_of_t<decltype(expr)>;
         static_assert(nodes::size == 7);
@@ -354,6 +354,32 @@ int main() {
         static_assert(is_any_of_v<decltype(expr), unique_composites>);
     };
 
+    "operation_equal_nodes_commutative_associative"_test = [] () {
+        using namespace xp::traits;
+
+        var a;
+        var b;
+        var c;
+        static_assert(a*b*c == c*(b*a));
+        static_assert((a + b) + c == c + (b + a));
+        static_assert(log(a*b) == log(b*a));
+        static_assert((a*b)/c == (b*a)/c);
+        static_assert(a*b + c != a*(b + c));
+        static_assert(a - b != b - a);
+
+        auto expr = log(a*b*c) + log(c*(b*a));
+        using unique_composites = unique_composite_nodes_of_t<decltype(expr)>;
+        static_assert(unique_composites::size == 4);
+    };
+
+    "operation_equal_nodes_simplification"_test = [] () {
+        var a;
+        var b;
+        static_assert(std::is_same_v<decltype(a*b - b*a), value<0>>);
+        static_assert(std::is_same_v<decltype(a*b/(b*a)), value<1>>);
+        static_assert(std::is_same_v<decltype(a*b + b*a), decltype(val<2>*(a*b))>);
+    };
+
     "operation_symbols_variables_of"_test = [] () {
         using namespace xp::traits;
 
@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <cmath>
+
+#include <xpress/symbols.hpp>
+#include <xpress/operators.hpp>
+#include <xpress/tensor.hpp>
+#include <xpress/forward_ad.hpp>
+#include <xpress/fast_math.hpp>
+
+#include "testing.hpp"
+
+int main() {
+    using namespace xp;
+    using namespace xp::testing;
+
+    "precise_policy_is_the_default"_test = [] () {
+        var a;
+        var b;
+        const auto expression = log(a)*pow(a, b)/b;
+        const auto values = at(a = 1.7, b = 0.3);
+        expect(eq(value_of<policy::precise>(expression, values), value_of(expression, values)));
+        expect(eq(value_of(expression, values), std::log(1.7)*std::pow(1.7, 0.3)/0.3));
+    };
+
+    "fast_policy_uses_fast_kernels"_test = [] () {
+        var a;
+        var b;
+        expect(eq(value_of<policy::fast>(log(a), at(a = 1.7)), fast_math::log(1.7)));
+        expect(eq(value_of<policy::fast>(pow(a, b), at(a = 1.7, b = 0.3)), fast_math::pow(1.7, 0.3)));
+        expect(eq(value_of<policy::fast>(a/b, at(a = 1.7, b = 0.3)), 1.7*(1.0/0.3)));
+        expect(eq(value_of<policy::fast>(exp(a), at(a = 1.7)), fast_math::exp(1.7)));
+    };
+
+    "fast_policy_pow_with_non_positive_base"_test = [] () {
+        var a;
+        var b;
+        expect(eq(value_of<policy::fast>(pow(a, b), at(a = -2.0, b = 2.0)), 4.0));
+        expect(eq(value_of<policy::fast>(pow(a, b), at(a = 0.0, b = 0.5)), 0.0));
+    };
+
+    "policy_replaces_policy_of_bindings"_test = [] () {
+        var a;
+        const auto fast_values = at(a = 1.7, value_binder{detail::policy_symbol{}, policy::fast{}});
+        expect(eq(value_of(log(a), fast_values), fast_math::log(1.7)));
+        expect(eq(value_of<policy::precise>(log(a), fast_values), std::log(1.7)));
+    };
+
+    "fast_policy_accuracy"_test = [] () {
+        var a;
+        var b;
+        const auto expression = exp(-b/a)*pow(a, b) + log(a*b)*sqrt(a) - tanh(b)/a;
+        for (double x = 0.1; x < 10.0; x += 0.1) {
+            const auto values = at(a = x, b = 2.5 - x/5.0);
+            expect(fuzzy_eq(value_of<policy::fast>(expression, values), value_of(expression, values), 1e-13));
+        }
+    };
+
+    "fast_policy_keeps_integer_semantics"_test = [] () {
+        var a;
+        var b;
+        static_assert(value_of<policy::fast>(a/b, at(a = 7, b = 2)) == 3);
+        expect(eq(value_of<policy::fast>(pow(a, b), at(a = 3.0, b = 2)), 9.0));
+    };
+
+    "fast_policy_tensor_division"_test = [] () {
+        linalg::tensor m{shape<2>, 1.0, 3.0};
+        const tensor t{shape<2>};
+        var s;
+        const auto result = value_of<policy::fast>(t/s, at(t = m, s = 3.0));
+        expect(eq(result[0], 1.0*(1.0/3.0)));
+        expect(eq(result[1], 3.0*(1.0/3.0)));
+    };
+
+    "fast_policy_tensor_log"_test = [] () {
+        linalg::tensor m{shape<2>, 2.0, 3.0};
+        const tensor t{shape<2>};
+        const auto result = value_of<policy::fast>(log(t), at(t = m));
+        expect(eq(result[0], fast_math::log(2.0)));
+        expect(eq(result[1], fast_math::log(3.0)));
+    };
+
+    "fast_policy_with_dual_numbers"_test = [] () {
+        var a;
+        const dual x{1.5, 1.0};
+        const auto result = value_of<policy::fast>(log(a)*pow(a, val<2>), at(a = x));
+        expect(fuzzy_eq(result.value, std::log(1.5)*1.5*1.5, 1e-14));
+        expect(fuzzy_eq(result.derivative, 1.5 + 2.0*1.5*std::log(1.5), 1e-14));
+    };
+
+    return 0;
+}
@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <sstream>
+#include <string>
+
+#include <xpress/symbols.hpp>
+#include <xpress/operators.hpp>
+#include <xpress/profiling.hpp>
+
+#include "testing.hpp"
+
+int main() {
+    using namespace xp;
+    using namespace xp::testing;
+
+    "profiler_counts_node_evaluations"_test = [] () {
+        var a;
+        var b;
+        const auto expression = a*b + log(a*b);
+
+        profiler p;
+        for (int i = 0; i < 3; ++i)
+            expect(eq(value_of(expression, at(a = 2.0, b = 3.0), p), value_of(expression, at(a = 2.0, b = 3.0))));
+        expect(eq(p.record_of(expression).calls, std::size_t{3}));
+        expect(eq(p.record_of(log(a*b)).calls, std::size_t{3}));
+        expect(eq(p.record_of(a*b).calls, std::size_t{6}));
+        expect(eq(p.record_of(a/b).calls, std::size_t{0}));
+        expect(p.record_of(expression).total >= p.record_of(expression).exclusive);
+        expect(p.total_time() >= p.record_of(expression).total);
+
+        p.reset();
+        expect(eq(p.record_of(expression).calls, std::size_t{0}));
+    };
+
+    "profiler_report"_test = [] () {
+        var a;
+        var b;
+        const auto expression = a*b + log(a*b);
+
+        profiler p;
+        value_of(expression, at(a = 2.0, b = 3.0), p);
+
+        std::ostringstream out;
+        p.write_report_to(out, expression, with(a = "a", b = "b"));
+        const std::string report = out.str();
+        expect(report.find("  a*b + log(a*b)\n") != std::string::npos);
+        expect(report.find("  log(a*b)\n") != std::string::npos);
+        expect(report.find("  a*b\n") != std::string::npos);
+        expect(report.find("a*b\n") == report.rfind("a*b\n"));
+    };
+
+    "uninstrumented_evaluation_is_constexpr"_test = [] () {
+        var a;
+        var b;
+        static_assert(value_of(a*b + a, at(a = 2, b = 3)) == 8);
+    };
+
+    return 0;
+}
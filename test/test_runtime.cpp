@@ -0,0 +1,146 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <xpress/symbols.hpp>
+#include <xpress/operators.hpp>
+#include <xpress/runtime.hpp>
+
+#include "testing.hpp"
+
+int main() {
+    using namespace xp;
+    using namespace xp::testing;
+
+    "runtime_graph_hash_consing"_test = [] () {
+        runtime::graph g;
+        const auto a = g.symbol("a");
+        const auto b = g.symbol("b");
+        const auto ab = g.multiply(a, b);
+        expect(eq(g.symbol("a"), a));
+        expect(eq(g.multiply(b, a), ab));
+        expect(eq(g.add(ab, a), g.add(a, g.multiply(b, a))));
+        expect(eq(g.symbol_count(), std::size_t{2}));
+    };
+
+    "runtime_graph_simplification"_test = [] () {
+        runtime::graph g;
+        const auto a = g.symbol("a");
+        expect(eq(g.multiply(g.constant(0), a), g.constant(0)));
+        expect(eq(g.multiply(g.constant(1), a), a));
+        expect(eq(g.subtract(a, a), g.constant(0)));
+        expect(eq(g.divide(a, a), g.constant(1)));
+        expect(eq(g.add(g.constant(2), g.constant(3)), g.constant(5)));
+        expect(eq(g.pow(g.constant(0), g.constant(0)), g.constant(1)));
+        expect(eq(g.pow(a, g.constant(0)), g.constant(1)));
+        expect(eq(g.pow(g.constant(0), g.constant(2)), g.constant(0)));
+        expect(g[g.pow(g.constant(0), g.constant(-1))].value == std::numeric_limits<double>::infinity());
+        expect(g[g.pow(g.constant(0), a)].kind == runtime::node_kind::operation);
+    };
+
+    "runtime_parse"_test = [] () {
+        runtime::graph g;
+        const auto e = runtime::parse("2*a^2 - log(b)/(a + b)", g);
+        expect(e.has_value());
+
+        std::ostringstream s;
+        g.write_to(s, *e);
+        expect(eq(s.str(), std::string{"2*(a^2) - log(b)/(a + b)"}));
+    };
+
+    "runtime_parse_precedence"_test = [] () {
+        runtime::graph g;
+        runtime::program p{g, {*runtime::parse("-2^2 + 2^3^2 - 8/4/2 + pow(2, 3)", g)}};
+        expect(eq(p({}), -4.0 + 512.0 - 1.0 + 8.0));
+    };
+
+    "runtime_parse_errors"_test = [] () {
+        runtime::graph g;
+        expect(!runtime::parse("a + ", g).has_value());
+        expect(!runtime::parse("(a + b", g).has_value());
+        expect(!runtime::parse("a $ b", g).has_value());
+        expect(!runtime::parse("log(a, b)", g).has_value());
+        expect(!runtime::parse("foo(a)", g).has_value());
+
+        const auto error = runtime::parse("a + det(b)", g);
+        expect(!error.has_value());
+        expect(eq(error.error().position, std::size_t{4}));
+    };
+
+    "runtime_parse_depth_limit"_test = [] () {
+        runtime::graph g;
+        const std::string nested = std::string(100000, '(') + "a" + std::string(100000, ')');
+        const auto error = runtime::parse(nested, g);
+        expect(!error.has_value());
+        expect(!runtime::parse("--a", g, 2).has_value());
+        expect(runtime::parse("--a", g, 3).has_value());
+        expect(runtime::parse("((a))", g, 3).has_value());
+    };
+
+    "runtime_deep_graph"_test = [] () {
+        runtime::graph g;
+        const auto a = g.symbol("a");
+        const auto b = g.symbol("b");
+        auto e = a;
+        for (int i = 0; i < 100000; ++i)
+            e = g.add(g.multiply(e, a), b);
+        runtime::program p{g, {e, g.derivative_of(e, b)}};
+
+        std::vector<double> out(2);
+        p.evaluate(std::vector{1.0, 1.0}, out);
+        expect(eq(out[0], 100001.0));
+        expect(eq(out[1], 100000.0));
+
+        std::ostringstream s;
+        g.write_to(s, e);
+        // operands of commutative operators are ordered by their identifiers
+        expect(s.str().starts_with("b + a*(b + a*("));
+        expect(s.str().ends_with("b + a*a)))"));
+    };
+
+    "runtime_program_matches_static_evaluation"_test = [] () {
+        var a;
+        var b;
+        const auto expression = a*b + log(a*b)/b - pow(a, b);
+
+        runtime::graph g;
+        runtime::program p{g, {*runtime::parse("a*b + log(a*b)/b - pow(a, b)", g)}};
+        for (double va : {0.5, 1.0, 2.0})
+            for (double vb : {0.25, 1.5, 3.0})
+                expect(eq(p({va, vb}), value_of(expression, at(a = va, b = vb))));
+    };
+
+    "runtime_program_shares_nodes"_test = [] () {
+        runtime::graph g;
+        runtime::program p{g, {*runtime::parse("a*b*c - c*(b*a)*c", g)}};
+        expect(eq(p.instructions().size(), std::size_t{4}));
+    };
+
+    "runtime_derivatives"_test = [] () {
+        var a;
+        var b;
+        const auto expression = a*a*b + pow(a, b) - log(a)/b;
+
+        runtime::graph g;
+        const auto e = *runtime::parse("a*a*b + pow(a, b) - log(a)/b", g);
+        const auto da = g.derivative_of(e, g.symbol("a"));
+        const auto db = g.derivative_of(e, g.symbol("b"));
+        runtime::program p{g, {e, da, db}};
+        expect(eq(p.output_size(), std::size_t{3}));
+
+        std::vector<double> out(3);
+        p.evaluate(std::vector{1.5, 2.5}, out);
+        const auto values = at(a = 1.5, b = 2.5);
+        expect(fuzzy_eq(out[0], value_of(expression, values)));
+        expect(fuzzy_eq(out[1], value_of(derivative_of(expression, wrt(a)), values)));
+        expect(fuzzy_eq(out[2], value_of(derivative_of(expression, wrt(b)), values)));
+        expect(eq(g.derivative_of(e, g.symbol("c")), g.constant(0)));
+    };
+
+    return 0;
+}
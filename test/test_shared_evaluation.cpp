@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <tuple>
+
+#include <xpress/symbols.hpp>
+#include <xpress/operators.hpp>
+#include <xpress/tensor.hpp>
+#include <xpress/profiling.hpp>
+#include <xpress/shared_evaluation.hpp>
+
+#include "testing.hpp"
+
+int main() {
+    using namespace xp;
+    using namespace xp::testing;
+
+    "shared_evaluation_constexpr"_test = [] () {
+        var a;
+        var b;
+        constexpr auto residual = a*b + a;
+        constexpr auto flux = log(a*b)*b;
+        constexpr auto storage = a;
+        constexpr auto values = evaluator{residual, flux, storage}.at(a = 2.0, b = 3.0);
+        static_assert(std::get<0>(values) == 8.0);
+        static_assert(std::get<2>(values) == 2.0);
+        expect(fuzzy_eq(std::get<1>(values), value_of(flux, at(a = 2.0, b = 3.0))));
+    };
+
+    "shared_evaluation_from_tuple"_test = [] () {
+        var a;
+        var b;
+        const auto [r1, r2] = value_of(std::tuple{a*b - b, b*a + val<1>}, at(a = 2, b = 3));
+        expect(eq(r1, 3));
+        expect(eq(r2, 7));
+    };
+
+    "shared_evaluation_evaluates_common_nodes_once"_test = [] () {
+        var a;
+        var b;
+        const auto ab = a*b;
+        const auto e1 = ab + log(ab);
+        const auto e2 = log(b*a)/b;
+
+        profiler p;
+        const auto [v1, v2] = value_of(std::tuple{e1, e2}, p.instrumented(at(a = 2.0, b = 3.0)));
+        expect(fuzzy_eq(v1, value_of(e1, at(a = 2.0, b = 3.0))));
+        expect(fuzzy_eq(v2, value_of(e2, at(a = 2.0, b = 3.0))));
+        expect(eq(p.record_of(ab).calls + p.record_of(b*a).calls, std::size_t{1}));
+        expect(eq(p.record_of(log(ab)).calls + p.record_of(log(b*a)).calls, std::size_t{1}));
+    };
+
+    "shared_evaluation_with_bound_subexpression"_test = [] () {
+        var a;
+        var b;
+        const auto ab = a*b;
+        const auto [v1, v2] = evaluator{ab + a, ab*b}(a = 2, b = 3, ab = 10);
+        expect(eq(v1, 12));
+        expect(eq(v2, 30));
+    };
+
+    "shared_evaluation_tensors"_test = [] () {
+        tensor T{shape<2, 2>};
+        const auto [sum, product] = evaluator{T + T, T*T}.at(T = linalg::tensor{shape<2, 2>, 1, 2, 3, 4});
+        expect(sum == linalg::tensor{shape<2, 2>, 2, 4, 6, 8});
+        expect(eq(product, 1+4+9+16));
+    };
+
+    return 0;
+}
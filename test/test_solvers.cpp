@@ -1,11 +1,67 @@
 // SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
 // SPDX-License-Identifier: MIT
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <optional>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
 #include <xpress/xp.hpp>
 #include <xpress/solvers/newton.hpp>
+#include <xpress/solvers/sparse_newton.hpp>
+#include <xpress/solvers/batched_newton.hpp>
+#include <xpress/solvers/ensemble.hpp>
+#include <xpress/solvers/least_squares.hpp>
+#include <xpress/solvers/minimizers.hpp>
 
 #include "testing.hpp"
 
+// discretization of the Bratu problem u'' + lambda*exp(u) = 0 with homogeneous boundary conditions
+template<typename X, std::size_t... i>
+constexpr auto bratu_system(const X& x, std::index_sequence<i...>) {
+    constexpr std::size_t n = sizeof...(i);
+    constexpr double lambda_h2 = 1.0/((n + 1.0)*(n + 1.0));
+    const auto equation = [&] <std::size_t k> (const xp::index_constant<k>&) {
+        const auto center = xp::val<-2>*x[xp::md_ic<k>] + xp::val<lambda_h2>*exp(x[xp::md_ic<k>]);
+        if constexpr (k == 0)
+            return center + x[xp::md_ic<k+1>];
+        else if constexpr (k == n - 1)
+            return x[xp::md_ic<k-1>] + center;
+        else
+            return x[xp::md_ic<k-1>] + center + x[xp::md_ic<k+1>];
+    };
+    return xp::tensor_expression{xp::shape<n>, equation(xp::ic<i>)...};
+}
+
+// residuals of fitting the model p0*exp(p1*t) to measurements (t_i, y_i)
+inline constexpr std::array<double, 6> measurement_times{0.0, 0.4, 0.8, 1.2, 1.6, 2.0};
+inline constexpr std::array<double, 6> measurement_values{2.01, 2.43, 2.99, 3.63, 4.46, 5.43};
+template<typename P0, typename P1, std::size_t... i>
+constexpr auto exponential_fit_residuals(const P0& p0, const P1& p1, std::index_sequence<i...>) {
+    return xp::tensor_expression{xp::shape<sizeof...(i)>,
+        (p0*exp(p1*xp::val<measurement_times[i]>) - xp::val<measurement_values[i]>)...
+    };
+}
+
+// chained Rosenbrock energy sum_k 100*(x_{k+1} - x_k^2)^2 + (1 - x_k)^2, which is minimal at x = (1, ..., 1)
+template<typename X, std::size_t... k>
+constexpr auto chained_rosenbrock_energy(const X& x, std::index_sequence<k...>) {
+    const auto term = [&] <std::size_t i> (const xp::index_constant<i>&) {
+        const auto stretch = x[xp::md_ic<i+1>] - x[xp::md_ic<i>]*x[xp::md_ic<i>];
+        const auto offset = xp::val<1.0> - x[xp::md_ic<i>];
+        return xp::val<100.0>*stretch*stretch + offset*offset;
+    };
+    return (... + term(xp::ic<k>));
+}
+
 int main() {
     using namespace xp;
     using namespace xp::solvers;
@@ -44,7 +100,152 @@ int main() {
         expect(!solvers::newton{{
             .threshold = 1e-6,
             .max_iterations = 1
-        }}.find_root_of(a*a - val<1.0>, starting_from(a = 3)).has_value());
+        }}.find_root_of(a*a - val<1.0>, starting_from(a = 3.0)).has_value());
+    };
+
+    "newton_solver_statistics"_test = [] () {
+        var a;
+        constexpr auto solution = solvers::newton{{
+            .threshold = 1e-10,
+            .max_iterations = 20
+        }}.find_root_of(a*a - val<2.0>, starting_from(a = 1.0));
+        static_assert(solution.has_value());
+        static_assert(solution.statistics.converged);
+        static_assert(solution.statistics.iterations > 0);
+        static_assert(solution.statistics.residual_evaluations == solution.statistics.iterations + 1);
+        static_assert(solution.statistics.jacobian_evaluations == solution.statistics.iterations);
+        static_assert(solution.statistics.residuals().size() == solution.statistics.iterations + 1);
+        static_assert(solution.statistics.residuals().front() == 1.0);
+        static_assert(solution.statistics.residuals().back() <= 1e-20);
+
+        // the chord method saves Jacobian evaluations
+        const auto chord_solution = solvers::newton{{
+            .threshold = 1e-10,
+            .max_iterations = 50,
+            .jacobian = jacobian_update::chord
+        }}.find_root_of(a*a - val<2.0>, starting_from(a = 1.4));
+        expect(chord_solution.has_value());
+        expect(chord_solution.statistics.jacobian_evaluations < chord_solution.statistics.iterations);
+
+        const auto failed = solvers::newton{{
+            .threshold = 1e-10,
+            .max_iterations = 2
+        }}.find_root_of(a*a - val<2.0>, starting_from(a = 100.0));
+        expect(!failed.has_value());
+        expect(!failed.statistics.converged);
+        expect(eq(failed.statistics.iterations, std::size_t{2}));
+    };
+
+    "newton_solver_observer"_test = [] () {
+        var a;
+        std::vector<std::size_t> iterations;
+        std::vector<double> residuals;
+        const auto solution = solvers::newton{
+            {.threshold = 1e-10, .max_iterations = 20},
+            [&] (const auto& statistics) {
+                iterations.push_back(statistics.iterations);
+                residuals.push_back(statistics.residual_norm_squared);
+            }
+        }.find_scalar_root_of(a*a - val<2.0>, starting_from(a = 1.0));
+        expect(solution.has_value());
+        expect(eq(iterations.size(), solution.statistics.iterations));
+        for (std::size_t i = 0; i < iterations.size(); ++i) {
+            expect(eq(iterations[i], i + 1));
+            expect(eq(residuals[i], solution.statistics.residuals()[i + 1]));
+        }
+    };
+
+    "newton_solver_deprecated_verbosity_level"_test = [] () {
+        var a;
+        std::ostringstream progress;
+        std::ostringstream expected;
+        auto* const cout_buffer = std::cout.rdbuf(progress.rdbuf());
+        const auto solution = solvers::newton{
+            {.threshold = 1e-10, .max_iterations = 20, .verbosity_level = 1},
+            stream_observer{expected}
+        }.find_scalar_root_of(a*a - val<2.0>, starting_from(a = 1.0));
+        std::cout.rdbuf(cout_buffer);
+        expect(solution.has_value());
+        expect(!progress.str().empty());
+        expect(eq(progress.str(), expected.str()));
+    };
+
+    "newton_solver_jacobian_updates"_test = [] () {
+        var a;
+        var b;
+        constexpr auto eq_system = vector_expression_builder<2>{}
+                                    .with(a*a + b - val<3.0>, at<0>())
+                                    .with(a - b*b + val<3.0>, at<1>())
+                                    .build();
+        for (const auto update : {jacobian_update::exact, jacobian_update::chord, jacobian_update::broyden}) {
+            const auto solution = solvers::newton{{
+                .threshold = 1e-10,
+                .max_iterations = 50,
+                .jacobian = update
+            }}.find_root_of(eq_system, starting_from(a = 1.5, b = 1.5));
+            expect(solution.has_value());
+            expect(fuzzy_eq((*solution)[a], 1.0));
+            expect(fuzzy_eq((*solution)[b], 2.0));
+        }
+
+        constexpr auto chord_solution = solvers::newton{{
+            .threshold = 1e-10,
+            .max_iterations = 50,
+            .jacobian = jacobian_update::chord
+        }}.find_scalar_root_of(a*a - val<2.0>, starting_from(a = 1.5));
+        static_assert(fuzzy_eq(*chord_solution, 1.41421356237, 1e-9));
+
+        constexpr auto broyden_solution = solvers::newton{{
+            .threshold = 1e-10,
+            .max_iterations = 50,
+            .jacobian = jacobian_update::broyden
+        }}.find_scalar_root_of(a*a - val<2.0>, starting_from(a = 1.5));
+        static_assert(fuzzy_eq(*broyden_solution, 1.41421356237, 1e-9));
+    };
+
+    "newton_solver_globalization"_test = [] () {
+        var a;
+        var b;
+        // full Newton steps diverge for tanh from initial guesses sufficiently far from the root
+        expect(!solvers::newton{{
+            .threshold = 1e-10,
+            .max_iterations = 50
+        }}.find_root_of(tanh(a), starting_from(a = 2.0)).has_value());
+
+        for (const auto strategy : {globalization_strategy::line_search, globalization_strategy::trust_region}) {
+            const auto root = solvers::newton{{
+                .threshold = 1e-10,
+                .max_iterations = 50,
+                .globalization = strategy
+            }}.find_scalar_root_of(tanh(a), starting_from(a = 2.0));
+            expect(root.has_value());
+            expect(fuzzy_eq(*root, 0.0, 1e-9));
+
+            const auto eq_system = vector_expression_builder<2>{}
+                                    .with(tanh(a), at<0>())
+                                    .with(b - a*a - val<1.0>, at<1>())
+                                    .build();
+            const auto solution = solvers::newton{{
+                .threshold = 1e-10,
+                .max_iterations = 50,
+                .globalization = strategy
+            }}.find_root_of(eq_system, starting_from(a = 2.0, b = 0.0));
+            expect(solution.has_value());
+            expect(fuzzy_eq((*solution)[a], 0.0, 1e-9));
+            expect(fuzzy_eq((*solution)[b], 1.0, 1e-9));
+        }
+
+        // without backtracking, the full step from a = 0.5 increases the residual of a^2 + 1 (which has no root)
+        const auto failed = solvers::newton{{
+            .threshold = 1e-10,
+            .max_iterations = 50,
+            .globalization = globalization_strategy::line_search,
+            .max_backtracking_steps = 0
+        }}.find_root_of(a*a + val<1.0>, starting_from(a = 0.5));
+        expect(!failed.has_value());
+        expect(eq(failed.statistics.iterations, std::size_t{1}));
+        expect(eq(failed.statistics.residual_evaluations, std::size_t{2}));
+        expect(eq(failed.statistics.jacobian_evaluations, std::size_t{1}));
     };
 
     "newton_solver_vector_equation"_test = [] () {
@@ -63,5 +264,404 @@ int main() {
         expect(fuzzy_eq((*solution)[b], 1.0));
     };
 
+    "sparse_lu_plan_arrow_pattern"_test = [] () {
+        // eliminating the tips of the arrow first avoids any fill-in
+        constexpr auto arrow = [] () {
+            std::array<bool, 25> pattern{};
+            for (std::size_t i = 0; i < 5; ++i)
+                pattern[i] = pattern[i*5] = pattern[i*5 + i] = true;
+            return pattern;
+        } ();
+        using plan = solvers::detail::sparse_lu_plan<5, arrow>;
+        static_assert(plan::is_structurally_regular);
+        static_assert(plan::nonzeros == 13);
+        static_assert(plan::jacobian_nonzeros == 13);
+    };
+
+    "sparse_lu_plan_matching"_test = [] () {
+        // the equations have to be permuted to obtain a zero-free diagonal
+        constexpr std::array<bool, 9> pattern{false, true, false, true, false, true, true, true, false};
+        using plan = solvers::detail::sparse_lu_plan<3, pattern>;
+        static_assert(plan::is_structurally_regular);
+        static_assert(pattern[plan::row_of_column[0]*3] && pattern[plan::row_of_column[1]*3 + 1]);
+        static_assert(pattern[plan::row_of_column[2]*3 + 2]);
+
+        constexpr std::array<bool, 4> singular{true, true, false, false};
+        static_assert(!solvers::detail::sparse_lu_plan<2, singular>::is_structurally_regular);
+    };
+
+    "sparse_newton_jacobian_pattern"_test = [] () {
+        var a; var b; var c;
+        using system = decltype(vector_expression_builder<3>{}
+                                    .with(b*b - val<4.0>, at<0>())
+                                    .with(c - a, at<1>())
+                                    .with(a + b - val<3.0>, at<2>())
+                                    .build());
+        constexpr auto pattern = solvers::detail::jacobian_pattern<system, decltype(a), decltype(b), decltype(c)>(
+            std::make_index_sequence<3>{}
+        );
+        static_assert(pattern == std::array<bool, 9>{false, true, false, true, false, true, true, true, false});
+    };
+
+    "sparse_newton_solver_constexpr"_test = [] () {
+        var a; var b; var c;
+        constexpr auto eq_system = vector_expression_builder<3>{}
+                                    .with(b*b - val<4.0>, at<0>())
+                                    .with(c - a, at<1>())
+                                    .with(a + b - val<3.0>, at<2>())
+                                    .build();
+        constexpr auto solution = solvers::sparse_newton{{
+            .threshold = 1e-10,
+            .max_iterations = 20
+        }}.find_root_of(eq_system, starting_from(a = 0.0, b = 3.0, c = 0.0));
+        static_assert(solution.has_value());
+        static_assert(fuzzy_eq((*solution)[a], 1.0));
+        static_assert(fuzzy_eq((*solution)[b], 2.0));
+        static_assert(fuzzy_eq((*solution)[c], 1.0));
+    };
+
+    "sparse_newton_solver_tensor_unknowns"_test = [] () {
+        static constexpr std::size_t n = 30;
+        const vector<n> x{};
+        const auto eq_system = bratu_system(x, std::make_index_sequence<n>{});
+        const auto solution = solvers::sparse_newton{{
+            .threshold = 1e-10,
+            .max_iterations = 20
+        }}.find_root_of(eq_system, wrt(x), starting_from(x = linalg::tensor<double, md_shape<n>>{0.0}));
+        expect(solution.has_value());
+        expect(solution.statistics.converged);
+        expect(eq(solution.statistics.jacobian_evaluations, solution.statistics.iterations));
+        expect(eq(solution.statistics.residual_evaluations, solution.statistics.iterations + 1));
+
+        const auto residual = value_of(eq_system, *solution);
+        for (std::size_t i = 0; i < n; ++i)
+            expect(std::abs(residual[i]) < 1e-10);
+        // the solution is positive and symmetric w.r.t. the center of the domain
+        expect((*solution)[x][0] > 0.0);
+        expect(fuzzy_eq((*solution)[x][0], (*solution)[x][n-1], 1e-12));
+    };
+
+    "sparse_newton_solver_failure"_test = [] () {
+        var a; var b;
+        const auto eq_system = vector_expression_builder<2>{}.with(a*a - val<1.0>, at<0>()).with(b, at<1>()).build();
+        expect(!solvers::sparse_newton{{
+            .threshold = 1e-6,
+            .max_iterations = 1
+        }}.find_root_of(eq_system, starting_from(a = 3.0, b = 1.0)).has_value());
+
+        // the zero pivot yields non-finite residuals, which must not be taken for convergence
+        const auto diverged = solvers::sparse_newton{{
+            .threshold = 1e-6,
+            .max_iterations = 20
+        }}.find_root_of(eq_system, starting_from(a = 0.0, b = 1.0));
+        expect(!diverged.has_value());
+        expect(!diverged.statistics.converged);
+    };
+
+    "batched_newton_solver_scalar"_test = [] () {
+        var x; let k;
+        constexpr std::size_t count = 13;
+        std::vector<double> guesses(count, 1.0);
+        std::vector<double> parameters(count);
+        for (std::size_t i = 0; i < count; ++i)
+            parameters[i] = static_cast<double>(i + 1);
+        parameters[5] = -1.0;
+
+        const auto status = solvers::batched_newton<double, 4>{{
+            .threshold = 1e-10,
+            .max_iterations = 50
+        }}.find_roots_of(x*x - k, starting_from(x = std::span{guesses}, k = std::span{parameters}));
+        expect(eq(status.size(), count));
+        for (std::size_t i = 0; i < count; ++i) {
+            if (i == 5) {
+                expect(!status[i].converged);
+                expect(status[i].iterations < 50);
+            } else {
+                expect(status[i].converged);
+                expect(status[i].iterations > 0 or i == 0);
+                expect(fuzzy_eq(guesses[i], std::sqrt(parameters[i]), 1e-8));
+            }
+        }
+    };
+
+    "batched_newton_solver_system_with_shared_parameter"_test = [] () {
+        var a; var b; let c;
+        const auto eq_system = vector_expression_builder<2>{}.with(a*a - c, at<0>()).with(b - a*c, at<1>()).build();
+        std::array<double, 3> a_values{1.0, 2.0, 3.0};
+        std::array<double, 3> b_values{0.0, 0.0, 0.0};
+        const auto status = solvers::batched_newton{{
+            .threshold = 1e-10,
+            .max_iterations = 20
+        }}.find_roots_of(eq_system, starting_from(a = std::span{a_values}, b = std::span{b_values}, c = 4.0));
+        for (std::size_t i = 0; i < 3; ++i) {
+            expect(status[i].converged);
+            expect(fuzzy_eq(a_values[i], 2.0, 1e-8));
+            expect(fuzzy_eq(b_values[i], 8.0, 1e-8));
+        }
+    };
+
+    "ensemble_solver"_test = [] () {
+        var x; let k;
+        const auto equation = x*x - k;
+        const auto initial_guess_of = [&] (std::size_t i) {
+            // guesses far from the root require many more iterations
+            return starting_from(x = (i % 7 == 0 ? 1e6 : 1.0), k = static_cast<double>(i + 1));
+        };
+        const solvers::newton solver{{.threshold = 1e-10, .max_iterations = 100}};
+
+        constexpr std::size_t count = 203;
+        using result_t = decltype(solver.find_root_of(equation, initial_guess_of(0)));
+        std::vector<result_t> results(count);
+        const auto statistics = solvers::ensemble{solver, {.number_of_threads = 4, .chunk_size = 5}}.solve(
+            equation, initial_guess_of, results
+        );
+        expect(eq(statistics.size(), std::size_t{4}));
+
+        std::size_t solves = 0;
+        std::size_t chunks = 0;
+        for (const auto& stats : statistics) {
+            solves += stats.solves;
+            chunks += stats.chunks;
+            expect(eq(stats.solves, stats.converged));
+        }
+        expect(eq(solves, count));
+        expect(eq(chunks, std::size_t{41}));
+
+        for (std::size_t i = 0; i < count; ++i) {
+            expect(results[i].has_value());
+            expect(fuzzy_eq((*results[i])[x], std::sqrt(static_cast<double>(i + 1)), 1e-8));
+            // results are independent of the schedule
+            expect(eq((*results[i])[x], (*solver.find_root_of(equation, initial_guess_of(i)))[x]));
+        }
+    };
+
+    "ensemble_solver_rethrows_exceptions"_test = [] () {
+        var x; let k;
+        const auto equation = x*x - k;
+        const auto initial_guess_of = [&] (std::size_t i) {
+            if (i == 42)
+                throw std::runtime_error("invalid instance");
+            return starting_from(x = 1.0, k = static_cast<double>(i + 1));
+        };
+        const solvers::newton solver{{.threshold = 1e-10, .max_iterations = 100}};
+
+        using result_t = decltype(solver.find_root_of(equation, initial_guess_of(0)));
+        std::vector<result_t> results(203);
+        bool has_thrown = false;
+        try {
+            solvers::ensemble{solver, {.number_of_threads = 4, .chunk_size = 5}}.solve(
+                equation, initial_guess_of, results
+            );
+        } catch (const std::runtime_error& e) {
+            has_thrown = std::string_view{e.what()} == "invalid instance";
+        }
+        expect(has_thrown);
+    };
+
+    "normal_equations_plan_skips_zero_products"_test = [] () {
+        // rows (a), (b) and (a, b): 5 instead of 3*3 products
+        static constexpr std::array<bool, 6> pattern{true, false, false, true, true, true};
+        using plan = solvers::detail::normal_equations_plan<3, 2, pattern>;
+        static_assert(plan::nonzeros == 4);
+        static_assert(plan::product_count == 5);
+    };
+
+    "gauss_newton_solver"_test = [] () {
+        var p0; var p1;
+        const auto residuals = exponential_fit_residuals(p0, p1, std::make_index_sequence<6>{});
+        const auto solution = solvers::gauss_newton{{
+            .threshold = 1e-10,
+            .max_iterations = 20
+        }}.find_least_squares_solution_of(residuals, starting_from(p0 = 1.0, p1 = 1.0));
+        expect(solution.has_value());
+        expect(fuzzy_eq((*solution)[p0], 2.0, 0.05));
+        expect(fuzzy_eq((*solution)[p1], 0.5, 0.05));
+
+        // the gradient of the sum of squares vanishes at the solution
+        const auto gradient = derivatives_of(residuals*residuals, wrt(p0, p1)).at(*solution);
+        expect(std::abs(gradient[p0]) < 1e-8);
+        expect(std::abs(gradient[p1]) < 1e-8);
+    };
+
+    "gauss_newton_solver_constexpr"_test = [] () {
+        var a; var b;
+        constexpr auto residuals = vector_expression_builder<3>{}
+                                    .with(a - val<1.0>, at<0>())
+                                    .with(b - val<2.0>, at<1>())
+                                    .with(a*b - val<2.0>, at<2>())
+                                    .build();
+        constexpr auto solution = solvers::gauss_newton{{
+            .threshold = 1e-12,
+            .max_iterations = 20
+        }}.find_least_squares_solution_of(residuals, starting_from(a = 3.0, b = 3.0));
+        static_assert(solution.has_value());
+        static_assert(fuzzy_eq((*solution)[a], 1.0));
+        static_assert(fuzzy_eq((*solution)[b], 2.0));
+    };
+
+    "least_squares_solver_non_finite_residuals"_test = [] () {
+        var p0; var p1;
+        const auto residuals = exponential_fit_residuals(p0, p1, std::make_index_sequence<6>{});
+        const auto nan = std::numeric_limits<double>::quiet_NaN();
+        const auto gauss_newton = solvers::gauss_newton{{
+            .threshold = 1e-10,
+            .max_iterations = 20
+        }}.find_least_squares_solution_of(residuals, starting_from(p0 = nan, p1 = 1.0));
+        expect(!gauss_newton.has_value());
+        expect(!gauss_newton.statistics.converged);
+
+        const auto levenberg_marquardt = solvers::levenberg_marquardt{{
+            .threshold = 1e-10,
+            .max_iterations = 20
+        }}.find_least_squares_solution_of(residuals, starting_from(p0 = 1.0, p1 = nan));
+        expect(!levenberg_marquardt.has_value());
+        expect(!levenberg_marquardt.statistics.converged);
+    };
+
+    "levenberg_marquardt_solver"_test = [] () {
+        var p0; var p1;
+        const auto residuals = exponential_fit_residuals(p0, p1, std::make_index_sequence<6>{});
+        const auto reference = solvers::gauss_newton{{
+            .threshold = 1e-10,
+            .max_iterations = 20
+        }}.find_least_squares_solution_of(residuals, starting_from(p0 = 1.0, p1 = 1.0));
+        // start far from the solution, where the undamped iteration overshoots
+        const auto solution = solvers::levenberg_marquardt{{
+            .threshold = 1e-10,
+            .max_iterations = 100
+        }}.find_least_squares_solution_of(residuals, starting_from(p0 = 10.0, p1 = 3.0));
+        expect(solution.has_value());
+        expect(fuzzy_eq((*solution)[p0], (*reference)[p0], 1e-6));
+        expect(fuzzy_eq((*solution)[p1], (*reference)[p1], 1e-6));
+    };
+
+    "levenberg_marquardt_solver_rosenbrock"_test = [] () {
+        var a; var b;
+        const auto residuals = vector_expression_builder<2>{}
+                                .with(val<10.0>*(b - a*a), at<0>())
+                                .with(val<1.0> - a, at<1>())
+                                .build();
+        const auto solution = solvers::levenberg_marquardt{{
+            .threshold = 1e-10,
+            .max_iterations = 100
+        }}.find_least_squares_solution_of(residuals, starting_from(a = -1.2, b = 1.0));
+        expect(solution.has_value());
+        expect(fuzzy_eq((*solution)[a], 1.0, 1e-8));
+        expect(fuzzy_eq((*solution)[b], 1.0, 1e-8));
+        // the Jacobian is only evaluated at accepted points
+        expect(solution.statistics.jacobian_evaluations <= solution.statistics.residual_evaluations);
+        const auto recorded = std::min(solution.statistics.iterations + 1, std::size_t{32});
+        expect(eq(solution.statistics.residuals().size(), recorded));
+    };
+
+
+    "lbfgs_minimizer_rosenbrock"_test = [] () {
+        var a; var b;
+        const auto energy = val<100.0>*(b - a*a)*(b - a*a) + (val<1.0> - a)*(val<1.0> - a);
+        const auto solution = solvers::lbfgs{{
+            .threshold = 1e-10,
+            .max_iterations = 100
+        }}.find_minimum_of(energy, starting_from(a = -1.2, b = 1.0));
+        expect(solution.has_value());
+        expect(fuzzy_eq((*solution)[a], 1.0, 1e-8));
+        expect(fuzzy_eq((*solution)[b], 1.0, 1e-8));
+        expect(solution.statistics.converged);
+        expect(solution.statistics.residual_evaluations > solution.statistics.iterations);
+        expect(eq(solution.statistics.jacobian_evaluations, std::size_t{0}));
+        expect(solution.statistics.residual_norm_squared <= 1e-20);
+    };
+
+    "minimizer_observers"_test = [] () {
+        var a; var b;
+        const auto energy = (a - val<1.0>)*(a - val<1.0>) + val<4.0>*(b + val<2.0>)*(b + val<2.0>);
+        std::vector<double> lbfgs_gradients;
+        const auto solution = solvers::lbfgs<double, 4, std::function<void(const solver_statistics<double>&)>>{
+            {.threshold = 1e-10, .max_iterations = 50},
+            [&] (const auto& statistics) { lbfgs_gradients.push_back(statistics.residual_norm_squared); }
+        }.find_minimum_of(energy, starting_from(a = 5.0, b = 5.0));
+        expect(solution.has_value());
+        expect(eq(lbfgs_gradients.size(), solution.statistics.iterations));
+        expect(eq(lbfgs_gradients.back(), solution.statistics.residual_norm_squared));
+
+        std::size_t descent_iterations = 0;
+        const auto descent = solvers::gradient_descent{
+            {.threshold = 1e-10, .max_iterations = 1000},
+            [&] (const auto& statistics) { descent_iterations = statistics.iterations; }
+        }.find_minimum_of(energy, starting_from(a = 5.0, b = 5.0));
+        expect(descent.has_value());
+        expect(eq(descent_iterations, descent.statistics.iterations));
+    };
+
+    "lbfgs_minimizer_tensor_unknowns"_test = [] () {
+        static constexpr std::size_t n = 10;
+        const vector<n> x{};
+        const auto energy = chained_rosenbrock_energy(x, std::make_index_sequence<n - 1>{});
+        const auto solution = solvers::lbfgs<double, 5>{{
+            .threshold = 1e-8,
+            .max_iterations = 500
+        }}.find_minimum_of(energy, wrt(x), starting_from(x = linalg::tensor<double, md_shape<n>>{0.5}));
+        expect(solution.has_value());
+        for (std::size_t i = 0; i < n; ++i)
+            expect(fuzzy_eq((*solution)[x][i], 1.0, 1e-6));
+    };
+
+    "lbfgs_minimizer_constexpr"_test = [] () {
+        var a; var b;
+        constexpr auto solution = solvers::lbfgs{{
+            .threshold = 1e-12,
+            .max_iterations = 20
+        }}.find_minimum_of(
+            (a - val<1.0>)*(a - val<1.0>) + val<10.0>*(b - a)*(b - a) + a*b,
+            starting_from(a = 3.0, b = -2.0)
+        );
+        static_assert(solution.has_value());
+        static_assert(fuzzy_eq((*solution)[a], 40.0/79.0));
+        static_assert(fuzzy_eq((*solution)[b], 38.0/79.0));
+    };
+
+    "lbfgs_minimizer_failure"_test = [] () {
+        var a; var b;
+        expect(!solvers::lbfgs{{
+            .threshold = 1e-10,
+            .max_iterations = 2
+        }}.find_minimum_of(
+            val<100.0>*(b - a*a)*(b - a*a) + (val<1.0> - a)*(val<1.0> - a),
+            starting_from(a = -1.2, b = 1.0)
+        ).has_value());
+    };
+
+    "gradient_descent_minimizer"_test = [] () {
+        var a; var b;
+        const auto solution = solvers::gradient_descent{{
+            .threshold = 1e-8,
+            .max_iterations = 1000
+        }}.find_minimum_of(
+            (a - val<1.0>)*(a - val<1.0>) + val<4.0>*(b + val<2.0>)*(b + val<2.0>),
+            starting_from(a = 5.0, b = 5.0)
+        );
+        expect(solution.has_value());
+        expect(fuzzy_eq((*solution)[a], 1.0, 1e-8));
+        expect(fuzzy_eq((*solution)[b], -2.0, 1e-8));
+    };
+
+    "minimizers_non_finite_objective"_test = [] () {
+        var a; var b;
+        const auto energy = (a - val<1.0>)*(a - val<1.0>) + val<4.0>*(b + val<2.0>)*(b + val<2.0>);
+        const auto nan = std::numeric_limits<double>::quiet_NaN();
+        const auto lbfgs = solvers::lbfgs{{
+            .threshold = 1e-10,
+            .max_iterations = 50
+        }}.find_minimum_of(energy, starting_from(a = nan, b = 5.0));
+        expect(!lbfgs.has_value());
+        expect(!lbfgs.statistics.converged);
+
+        const auto descent = solvers::gradient_descent{{
+            .threshold = 1e-10,
+            .max_iterations = 50
+        }}.find_minimum_of(energy, starting_from(a = 5.0, b = nan));
+        expect(!descent.has_value());
+        expect(!descent.statistics.converged);
+    };
+
     return 0;
 }
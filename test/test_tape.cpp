@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <cmath>
+
+#include <xpress/symbols.hpp>
+#include <xpress/operators.hpp>
+#include <xpress/tape.hpp>
+
+#include "testing.hpp"
+
+int main() {
+    using namespace xp;
+    using namespace xp::testing;
+
+    "tape_instructions"_test = [] () {
+        var a;
+        var b;
+        constexpr auto t = compile_to_tape(a*b + log(a*b));
+        static_assert(t.registers == 5);
+        static_assert(t.instructions.size() == 3);
+        static_assert(t.instructions[0].code == bytecode::opcode::multiply);
+        static_assert(t.instructions[1].code == bytecode::opcode::log);
+        static_assert(t.instructions[2].code == bytecode::opcode::add);
+        static_assert(t.instructions[1].lhs == t.instructions[0].out);
+        static_assert(t.instructions[2].lhs == t.instructions[0].out);
+        static_assert(t.instructions[2].rhs == t.instructions[1].out);
+    };
+
+    "tape_shares_equal_nodes"_test = [] () {
+        var a;
+        var b;
+        var c;
+        constexpr auto t = compile_to_tape(a*b*c - c*(b*a)*c);
+        static_assert(t.instructions.size() == 4);
+    };
+
+    "tape_registers_of_equal_nodes"_test = [] () {
+        var a;
+        var b;
+        using nodes = type_list<decltype(a), decltype(b), decltype(a*b), decltype(log(a*b))>;
+        static_assert(detail::register_of<decltype(log(a*b))>(nodes{}) == 3);
+        static_assert(detail::register_of<decltype(b*a)>(nodes{}) == 2);
+        static_assert(detail::register_of<decltype(a + b)>(nodes{}) == nodes::size);
+    };
+
+    "tape_evaluation_constexpr"_test = [] () {
+        var a;
+        var b;
+        constexpr auto expression = (a + b)*(a - val<2>)/b;
+        constexpr auto t = compile_to_tape(expression);
+        static_assert(t.at(a = 4, b = 2) == value_of(expression, at(a = 4, b = 2)));
+        static_assert(t(a = 4.0, b = 3.0) == value_of(expression, at(a = 4.0, b = 3.0)));
+    };
+
+    "tape_evaluation"_test = [] () {
+        var a;
+        let b;
+        constexpr auto expression = pow(a, b)*log(a + b) - a/b;
+        constexpr auto t = compile_to_tape(expression);
+        expect(eq(t.at(a = 1.5, b = 2.5), value_of(expression, at(a = 1.5, b = 2.5))));
+        expect(eq(t(with(a = 3.0, b = 0.5)), value_of(expression, at(a = 3.0, b = 0.5))));
+    };
+
+    "tape_evaluation_leaf_expression"_test = [] () {
+        var a;
+        constexpr auto t = compile_to_tape(a);
+        static_assert(t.instructions.size() == 0);
+        static_assert(t.at(a = 42) == 42);
+    };
+
+    return 0;
+}
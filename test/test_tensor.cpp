@@ -269,6 +269,111 @@ int main() {
         expect(dr_db == linalg::tensor{shape<2>, (1 + 2*a_value), (3 + 4*a_value)});
     };
 
+    "tensor_transpose_trace_inverse"_test = [] () {
+        const tensor T{shape<2, 2>};
+        constexpr linalg::tensor T_value{shape<2, 2>, 1.0, 2.0, 3.0, 4.0};
+        static_assert(value_of(transpose(T), at(T = T_value)) == linalg::tensor{shape<2, 2>, 1.0, 3.0, 2.0, 4.0});
+        static_assert(value_of(trace(T), at(T = T_value)) == 5.0);
+        static_assert(value_of(inverse(T), at(T = T_value)) == linalg::tensor{shape<2, 2>, -2.0, 1.0, 1.5, -0.5});
+        static_assert(value_of(trace(mat_mul(T, inverse(T))), at(T = T_value)) == 2.0);
+    };
+
+    "tensor_transpose_trace_inverse_simplifications"_test = [] () {
+        const tensor T{shape<2, 3>};
+        const tensor S{shape<3, 3>};
+        static_assert(std::is_same_v<decltype(transpose(transpose(T))), std::remove_cvref_t<decltype(T)>>);
+        static_assert(std::is_same_v<decltype(inverse(inverse(S))), std::remove_cvref_t<decltype(S)>>);
+        static_assert(std::is_same_v<decltype(trace(transpose(S))), decltype(trace(S))>);
+        static_assert(shape_of_t<decltype(transpose(T))>{} == shape<3, 2>);
+        static_assert(shape_of_t<decltype(mat_mul(inverse(S), transpose(T)))>{} == shape<3, 2>);
+    };
+
+    "tensor_trace_derivative"_test = [] () {
+        const tensor T{shape<2, 2>};
+        constexpr linalg::tensor T_value{shape<2, 2>, 1.0, 2.0, 3.0, 4.0};
+        expect(derivative_of(trace(T), wrt(T), at(T = T_value)) == linalg::tensor{shape<2, 2>, 1, 0, 0, 1});
+        expect(eq(derivative_of(trace(T), wrt(T[md_ic<1, 1>]), at(T = T_value)), 1));
+        expect(eq(derivative_of(trace(T), wrt(T[md_ic<0, 1>]), at(T = T_value)), 0));
+    };
+
+    "tensor_transpose_derivative"_test = [] () {
+        const tensor T{shape<2, 2>};
+        constexpr linalg::tensor T_value{shape<2, 2>, 1.0, 2.0, 3.0, 4.0};
+        const auto dTt_dT01 = derivative_of(transpose(T), wrt(T[md_ic<0, 1>]), at(T = T_value));
+        expect(dTt_dT01 == linalg::tensor{shape<2, 2>, 0, 0, 1, 0});
+    };
+
+    "tensor_inverse_derivative"_test = [] () {
+        var a;
+        const auto T = tensor_expression_builder{shape<2, 2>}
+                        .with(a, at<0, 0>())
+                        .with(val<1>, at<0, 1>())
+                        .with(val<2>, at<1, 0>())
+                        .with(a*a, at<1, 1>())
+                        .build();
+        const tensor S{shape<2, 2>};
+        const vector<2> v{};
+        const auto expression = mat_mul(inverse(T), v) + mat_mul(inverse(S), v);
+
+        const double a_value = 3.0;
+        const double eps = 1e-6;
+        constexpr linalg::tensor S_value{shape<2, 2>, 2.0, 1.0, 1.0, 3.0};
+        constexpr linalg::tensor v_value{shape<2>, 1.0, -2.0};
+        const auto value_at = [&] (double _a, const auto& _S, std::size_t i) {
+            return value_of(expression, at(a = _a, S = _S, v = v_value))[i];
+        };
+
+        const auto dr_da = derivative_of(expression, wrt(a), at(a = a_value, S = S_value, v = v_value));
+        for (std::size_t i : {0, 1})
+            expect(fuzzy_eq(
+                dr_da[i],
+                (value_at(a_value + eps, S_value, i) - value_at(a_value - eps, S_value, i))/(2.0*eps),
+                1e-6
+            ));
+
+        const auto dr_dS10 = derivative_of(expression, wrt(S[md_ic<1, 0>]), at(a = a_value, S = S_value, v = v_value));
+        const auto S_plus = linalg::tensor{shape<2, 2>, 2.0, 1.0, 1.0 + eps, 3.0};
+        const auto S_minus = linalg::tensor{shape<2, 2>, 2.0, 1.0, 1.0 - eps, 3.0};
+        for (std::size_t i : {0, 1})
+            expect(fuzzy_eq(
+                dr_dS10[i],
+                (value_at(a_value, S_plus, i) - value_at(a_value, S_minus, i))/(2.0*eps),
+                1e-6
+            ));
+    };
+
+    "tensor_transpose_trace_inverse_stream"_test = [] () {
+        const tensor T{shape<2, 2>};
+        std::ostringstream s;
+        write_to(s, trace(mat_mul(inverse(T), transpose(T))), at(T = "T"));
+        expect(eq(s.str(), std::string{"trace((inverse(T))*(transpose(T)))"}));
+    };
+
+    "tensor_with_symmetric_values"_test = [] () {
+        const tensor A{shape<3, 3>};
+        const tensor B{shape<3, 3>};
+        constexpr linalg::symmetric_tensor<double, 3> A_value{4.0, 5.0, 6.0, 1.0, 2.0, 3.0};
+        constexpr linalg::symmetric_tensor<double, 3> B_value{1.0, 2.0, 3.0, 0.5, 0.0, 1.0};
+        constexpr linalg::tensor A_full{shape<3, 3>, 4.0, 3.0, 2.0, 3.0, 5.0, 1.0, 2.0, 1.0, 6.0};
+        constexpr linalg::tensor B_full{shape<3, 3>, 1.0, 1.0, 0.0, 1.0, 2.0, 0.5, 0.0, 0.5, 3.0};
+        const auto symmetric = at(A = A_value, B = B_value);
+        const auto full = at(A = A_full, B = B_full);
+
+        static_assert(std::is_same_v<
+            std::remove_cvref_t<decltype(value_of(A + B, symmetric))>,
+            linalg::symmetric_tensor<double, 3>
+        >);
+        expect(value_of(A + B, symmetric) == value_of(A + B, full));
+        expect(value_of(A - B, symmetric) == value_of(A - B, full));
+        expect(value_of(A*val<2>, symmetric) == linalg::symmetric_tensor<double, 3>{8.0, 10.0, 12.0, 2.0, 4.0, 6.0});
+        expect(value_of(A*B, symmetric) == value_of(A*B, full));
+        expect(value_of(contract<"ij,ij->">(A, B), symmetric) == value_of(contract<"ij,ij->">(A, B), full));
+        expect(value_of(contract<"ij,ji->">(A, B), symmetric) == value_of(contract<"ij,ji->">(A, B), full));
+        expect(value_of(det(A), symmetric) == value_of(det(A), full));
+        expect(value_of(mat_mul(A, B), symmetric) == value_of(mat_mul(A, B), full));
+        expect(value_of(contract<"ij,jk->ik">(A, B), symmetric) == value_of(mat_mul(A, B), full));
+    };
+
     "tensor_2x2_determinant_derivative"_test = [] () {
         const linalg::tensor value{shape<2, 2>, 1.0, 2.0, 3.0, 4.0};
         const auto determinant = -2.0;
@@ -453,6 +558,39 @@ int main() {
         expect(eq(value_of(v, at(a = 42))[md_ic<1>], 43));
     };
 
+    "tensor_expression_value_with_structural_zeros"_test = [] () {
+        var a;
+        const tensor T{shape<2, 2>};
+        const vector<2> v{};
+        constexpr linalg::tensor T_value{shape<2, 2>, 1.0, 2.0, 3.0, 4.0};
+        constexpr linalg::tensor v_value{shape<2>, 5.0, 6.0};
+        constexpr tensor_expression E01{shape<2, 2>, val<0>, val<1>, val<0>, val<0>};
+        constexpr tensor_expression A{shape<2, 2>, a, val<0>, val<0>, a};
+
+        using A_value = decltype(value_of(A, at(a = 2.0)));
+        static_assert(A_value::stored_count == 2);
+        static_assert(value_of(A, at(a = 2.0)) == linalg::tensor{shape<2, 2>, 2.0, 0.0, 0.0, 2.0});
+
+        // the derivative w.r.t. a tensor entry only has a single non-zero row in the product
+        const auto dr_dT01 = derivative_of(mat_mul(T, v), wrt(T[md_ic<0, 1>]), at(T = T_value, v = v_value));
+        static_assert(linalg::structural_zeros_v<std::remove_cvref_t<decltype(dr_dT01)>> == std::array{false, true});
+        expect(dr_dT01 == linalg::tensor{shape<2>, 6.0, 0.0});
+
+        const auto E01_T = value_of(contract<"ij,jk->ik">(E01, T), at(T = T_value));
+        static_assert(linalg::structural_zeros_v<std::remove_cvref_t<decltype(E01_T)>>
+                      == std::array{false, false, true, true});
+        expect(E01_T == linalg::tensor{shape<2, 2>, 3.0, 4.0, 0.0, 0.0});
+        expect(eq(value_of(contract<"ij,ij->">(E01, T), at(T = T_value)), 2.0));
+
+        const auto scaled = value_of(A*a, at(a = 2.0));
+        static_assert(std::remove_cvref_t<decltype(scaled)>::stored_count == 2);
+        expect(scaled == linalg::tensor{shape<2, 2>, 4.0, 0.0, 0.0, 4.0});
+        expect(value_of(A/a, at(a = 2.0)) == linalg::tensor{shape<2, 2>, 1.0, 0.0, 0.0, 1.0});
+        expect(value_of(A + E01, at(a = 2.0)) == linalg::tensor{shape<2, 2>, 2.0, 1.0, 0.0, 2.0});
+        expect(value_of(A - E01, at(a = 2.0)) == linalg::tensor{shape<2, 2>, 2.0, -1.0, 0.0, 2.0});
+        expect(value_of(A*T, at(a = 2.0, T = T_value)) == 10.0);
+    };
+
     "vector_expression_builder"_test = [] () {
         var a; var b;
         constexpr auto vector = vector_expression_builder<2>{}
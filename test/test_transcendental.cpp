@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.a.glaeser@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <cmath>
+#include <limits>
+#include <string>
+#include <sstream>
+#include <type_traits>
+
+#include <xpress/symbols.hpp>
+#include <xpress/operators.hpp>
+#include <xpress/tensor.hpp>
+#include <xpress/forward_ad.hpp>
+#include <xpress/fast_math.hpp>
+
+#include "testing.hpp"
+
+int main() {
+    using namespace xp;
+    using namespace xp::testing;
+
+    "transcendental_operator_values"_test = [] () {
+        var a;
+        expect(eq(value_of(exp(a), at(a = 1.5)), std::exp(1.5)));
+        expect(eq(value_of(sqrt(a), at(a = 2.0)), std::sqrt(2.0)));
+        expect(eq(value_of(sin(a), at(a = 0.5)), std::sin(0.5)));
+        expect(eq(value_of(cos(a), at(a = 0.5)), std::cos(0.5)));
+        expect(eq(value_of(tanh(a), at(a = 0.5)), std::tanh(0.5)));
+    };
+
+    "transcendental_operator_simplifications"_test = [] () {
+        static_assert(std::is_same_v<decltype(exp(val<0>)), value<1>>);
+        static_assert(std::is_same_v<decltype(sqrt(val<1>)), value<1>>);
+        static_assert(std::is_same_v<decltype(sin(val<0>)), value<0>>);
+        static_assert(std::is_same_v<decltype(cos(val<0>)), value<1>>);
+        static_assert(std::is_same_v<decltype(tanh(val<0>)), value<0>>);
+    };
+
+    "transcendental_operator_derivatives"_test = [] () {
+        var a;
+        const auto values = at(a = 0.7);
+        expect(fuzzy_eq(derivative_of(exp(a*a), wrt(a), values), 2*0.7*std::exp(0.7*0.7)));
+        expect(fuzzy_eq(derivative_of(sqrt(a), wrt(a), values), 0.5/std::sqrt(0.7)));
+        expect(fuzzy_eq(derivative_of(sin(a), wrt(a), values), std::cos(0.7)));
+        expect(fuzzy_eq(derivative_of(cos(a), wrt(a), values), -std::sin(0.7)));
+        expect(fuzzy_eq(derivative_of(tanh(a), wrt(a), values), 1.0 - std::tanh(0.7)*std::tanh(0.7)));
+    };
+
+    "transcendental_operator_forward_ad"_test = [] () {
+        var a;
+        var b;
+        const auto expression = exp(a*b) + sqrt(a)*sin(b) - cos(a)*tanh(a*b);
+        const auto values = at(a = 0.3, b = 1.2);
+        expect(fuzzy_eq(
+            derivative_of<differentiation::forward_ad>(expression, wrt(a), values),
+            derivative_of(expression, wrt(a), values)
+        ));
+        expect(fuzzy_eq(
+            derivative_of<differentiation::forward_ad>(expression, wrt(b), values),
+            derivative_of(expression, wrt(b), values)
+        ));
+    };
+
+    "transcendental_operator_stream"_test = [] () {
+        var a;
+        std::ostringstream out;
+        write_to(out, exp(sin(a)) + tanh(a), with(a = "a"));
+        expect(eq(out.str(), std::string{"exp(sin(a)) + tanh(a)"}));
+    };
+
+    "tensor_exp_operator"_test = [] () {
+        linalg::tensor m{shape<2, 2>, 0.0, 1.0, 2.0, 3.0};
+        linalg::tensor exp_m{shape<2, 2>, std::exp(0.0), std::exp(1.0), std::exp(2.0), std::exp(3.0)};
+        const tensor t{shape<2, 2>};
+        expect(value_of(exp(t), at(t = m)) == exp_m);
+    };
+
+    "operator_with_fast_policy"_test = [] () {
+        static_assert(operators::exp::with_policy<policy::fast>{}(0.0) == 1.0);
+        expect(eq(operators::sin::with_policy<policy::fast>{}(0.5), fast_math::sin(0.5)));
+        expect(fuzzy_eq(operators::sin::with_policy<policy::fast>{}(0.5), std::sin(0.5), 1e-15));
+
+        linalg::tensor m{shape<2>, 0.5, 1.5};
+        const auto fast_tanh = operators::tanh::with_policy<policy::fast>{}(m);
+        expect(eq(fast_tanh[0], fast_math::tanh(0.5)));
+        expect(eq(fast_tanh[1], fast_math::tanh(1.5)));
+    };
+
+    "fast_math_accuracy"_test = [] () {
+        for (double x = -20.0; x <= 20.0; x += 0.01) {
+            expect(fuzzy_eq(fast_math::exp(x)/std::exp(x), 1.0, 1e-15));
+            expect(fuzzy_eq(fast_math::expm1(x), std::expm1(x), 1e-15*std::max(1.0, std::abs(std::expm1(x)))));
+            expect(fuzzy_eq(fast_math::sin(x), std::sin(x), 1e-15));
+            expect(fuzzy_eq(fast_math::cos(x), std::cos(x), 1e-15));
+            expect(fuzzy_eq(fast_math::tanh(x), std::tanh(x), 1e-15));
+        }
+        for (float x = -20.0f; x <= 20.0f; x += 0.01f) {
+            expect(fuzzy_eq(fast_math::exp(x)/std::exp(x), 1.0f, 1e-6f));
+            expect(fuzzy_eq(fast_math::sin(x), std::sin(x), 1e-6f));
+            expect(fuzzy_eq(fast_math::tanh(x), std::tanh(x), 1e-6f));
+        }
+        static_assert(fast_math::exp(0.0) == 1.0);
+        static_assert(fast_math::sin(0.0) == 0.0);
+    };
+
+    "fast_math_exp_range"_test = [] () {
+        constexpr double inf = std::numeric_limits<double>::infinity();
+        expect(eq(fast_math::exp(1000.0), inf));
+        expect(eq(fast_math::exp(-1000.0), 0.0));
+        expect(eq(fast_math::exp(inf), inf));
+        expect(eq(fast_math::exp(-inf), 0.0));
+        expect(eq(fast_math::exp(100.0f), std::numeric_limits<float>::infinity()));
+        expect(eq(fast_math::exp(-110.0f), 0.0f));
+        expect(eq(fast_math::expm1(1000.0), inf));
+        expect(eq(fast_math::expm1(-1000.0), -1.0));
+        // results close to the limits of the range of normal numbers and subnormal results
+        expect(fuzzy_eq(fast_math::exp(709.7)/std::exp(709.7), 1.0, 1e-15));
+        expect(fuzzy_eq(fast_math::exp(-708.0)/std::exp(-708.0), 1.0, 1e-15));
+        expect(fuzzy_eq(fast_math::exp(-740.0)/std::exp(-740.0), 1.0, 1e-2));
+        expect(fuzzy_eq(fast_math::exp(-100.0f)/std::exp(-100.0f), 1.0f, 1e-1f));
+    };
+
+    return 0;
+}